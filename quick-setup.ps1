@@ -37,7 +37,7 @@ function Auto-Setup {
     # Compile programs
     if (Get-Command "g++" -ErrorAction SilentlyContinue) {
         Write-Info "Compiling programs..."
-        & g++ -std=c++11 -O2 -o enhanced_analyzer.exe src\main.cpp src\network_analyzer.cpp 2>
+        & g++ -std=c++11 -O2 -pthread -o enhanced_analyzer.exe src\main.cpp src\network_analyzer.cpp src\mapped_file.cpp src\traffic_aggregator.cpp src\rollup_pyramid.cpp src\ingest_pipeline.cpp src\columnar_store.cpp src\flow_aggregator.cpp src\heavy_hitters.cpp src\hyperloglog.cpp src\traffic_profile.cpp src\kll_sketch.cpp src\interpolation_engine.cpp src\integral_index.cpp src\adaptive_quadrature.cpp src\derivative_engine.cpp src\analysis_report.cpp src\anomaly_detector.cpp src\peak_finder.cpp src\ode_forecaster.cpp src\ensemble_forecaster.cpp src\model_calibrator.cpp 2>
         & g++ -std=c++11 -O2 -o data_visualizer.exe data_visualizer.cpp 2>  
         & g++ -std=c++11 -O2 -o simple_visualizer.exe simple_visualizer.cpp 2>
         
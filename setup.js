@@ -22,7 +22,7 @@ function autoSetup() {
         
         // Compile programs
         const ext = isWindows ? '.exe' : '';
-        execSync(`${compiler} -std=c++11 -O2 -o enhanced_analyzer${ext} src/main.cpp src/network_analyzer.cpp`);
+        execSync(`${compiler} -std=c++11 -O2 -pthread -o enhanced_analyzer${ext} src/main.cpp src/network_analyzer.cpp src/mapped_file.cpp src/traffic_aggregator.cpp src/rollup_pyramid.cpp src/ingest_pipeline.cpp src/columnar_store.cpp src/flow_aggregator.cpp src/heavy_hitters.cpp src/hyperloglog.cpp src/traffic_profile.cpp src/kll_sketch.cpp src/interpolation_engine.cpp src/integral_index.cpp src/adaptive_quadrature.cpp src/derivative_engine.cpp src/analysis_report.cpp src/anomaly_detector.cpp src/peak_finder.cpp src/ode_forecaster.cpp src/ensemble_forecaster.cpp src/model_calibrator.cpp`);
         execSync(`${compiler} -std=c++11 -O2 -o data_visualizer${ext} data_visualizer.cpp`);
         execSync(`${compiler} -std=c++11 -O2 -o simple_visualizer${ext} simple_visualizer.cpp`);
         
@@ -0,0 +1,140 @@
+#include "adaptive_quadrature.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct SimpsonState {
+    const AdaptiveQuadrature::Integrand& f;
+    const QuadratureOptions& options;
+    QuadratureResult& result;
+    SimpsonState(const AdaptiveQuadrature::Integrand& function, const QuadratureOptions& opts, QuadratureResult& out)
+        : f(function), options(opts), result(out) {}
+};
+
+double evaluate(SimpsonState& state, double x) {
+    state.result.evaluations++;
+    return state.f(x);
+}
+
+// Satu panel [a, b] dengan nilai fa, fm, fb dan estimasi Simpson whole.
+// Dua setengah panel hanya butuh 2 evaluasi baru; selisihnya / 15
+// adalah estimasi galat, dan ditambahkan sebagai koreksi Richardson.
+double refine(SimpsonState& state, double a, double b, double fa, double fm, double fb,
+              double whole, double tolerance, int depth) {
+    double m = (a + b) / 2.0;
+    double left_mid = (a + m) / 2.0;
+    double right_mid = (m + b) / 2.0;
+    double flm = evaluate(state, left_mid);
+    double frm = evaluate(state, right_mid);
+    double left = (m - a) / 6.0 * (fa + 4.0 * flm + fm);
+    double right = (b - m) / 6.0 * (fm + 4.0 * frm + fb);
+    double delta = left + right - whole;
+
+    bool accurate = depth >= state.options.min_depth && std::fabs(delta) <= 15.0 * tolerance;
+    bool exhausted = depth >= state.options.max_depth ||
+                     state.result.evaluations + 2 > state.options.max_evaluations ||
+                     !(m > a && b > m); // Panel tidak bisa dibagi lagi (presisi double)
+    if (accurate || exhausted || !std::isfinite(delta)) {
+        if (!accurate) state.result.converged = false;
+        state.result.error_estimate += std::fabs(delta) / 15.0;
+        return left + right + delta / 15.0;
+    }
+    return refine(state, a, m, fa, flm, fm, left, tolerance / 2.0, depth + 1) +
+           refine(state, m, b, fm, frm, fb, right, tolerance / 2.0, depth + 1);
+}
+
+double toleranceFor(const QuadratureOptions& options, double estimate) {
+    return std::max(options.absolute_tolerance, options.relative_tolerance * std::fabs(estimate));
+}
+
+} // namespace
+
+const char* AdaptiveQuadrature::ruleName(QuadratureRule rule) {
+    switch (rule) {
+        case QuadratureRule::AdaptiveSimpson: return "Adaptive Simpson";
+        case QuadratureRule::Romberg: return "Romberg";
+    }
+    return "-";
+}
+
+QuadratureResult AdaptiveQuadrature::integrate(const Integrand& f, double a, double b, QuadratureRule rule,
+                                               const QuadratureOptions& options) {
+    return rule == QuadratureRule::Romberg ? romberg(f, a, b, options) : simpson(f, a, b, options);
+}
+
+QuadratureResult AdaptiveQuadrature::simpson(const Integrand& f, double a, double b,
+                                             const QuadratureOptions& options) {
+    QuadratureResult result;
+    if (a == b) return result;
+    double sign = 1.0;
+    if (a > b) {
+        std::swap(a, b);
+        sign = -1.0;
+    }
+
+    SimpsonState state(f, options, result);
+    double fa = evaluate(state, a);
+    double fm = evaluate(state, (a + b) / 2.0);
+    double fb = evaluate(state, b);
+    double whole = (b - a) / 6.0 * (fa + 4.0 * fm + fb);
+
+    result.value = sign * refine(state, a, b, fa, fm, fb, whole, toleranceFor(options, whole), 0);
+    return result;
+}
+
+QuadratureResult AdaptiveQuadrature::romberg(const Integrand& f, double a, double b,
+                                             const QuadratureOptions& options) {
+    QuadratureResult result;
+    if (a == b) return result;
+    double sign = 1.0;
+    if (a > b) {
+        std::swap(a, b);
+        sign = -1.0;
+    }
+
+    // Hanya dua baris tabel Romberg yang disimpan
+    int levels = std::max(1, options.max_romberg_levels);
+    std::vector<double> previous(1), current;
+    previous[0] = (b - a) / 2.0 * (f(a) + f(b));
+    result.evaluations = 2;
+
+    double width = b - a;
+    size_t panels = 1;
+    double best = previous[0];
+    result.converged = false;
+    for (int k = 1; k <= levels; k++) {
+        if (result.evaluations + panels > options.max_evaluations) break;
+
+        // Trapesium 2^k interval = setengah trapesium sebelumnya + titik tengah baru
+        width /= 2.0;
+        double midpoints = 0.0;
+        for (size_t i = 0; i < panels; i++) {
+            midpoints += f(a + (2.0 * static_cast<double>(i) + 1.0) * width);
+        }
+        result.evaluations += panels;
+        panels *= 2;
+
+        current.assign(static_cast<size_t>(k) + 1, 0.0);
+        current[0] = previous[0] / 2.0 + width * midpoints;
+        double factor = 1.0;
+        for (int j = 1; j <= k; j++) {
+            factor *= 4.0;
+            current[j] = current[j - 1] + (current[j - 1] - previous[j - 1]) / (factor - 1.0);
+        }
+
+        best = current[k];
+        result.error_estimate = std::fabs(current[k] - previous[k - 1]);
+        previous.swap(current);
+        if (!std::isfinite(best)) break;
+        if (k >= options.min_depth && result.error_estimate <= toleranceFor(options, best)) {
+            result.converged = true;
+            break;
+        }
+    }
+
+    result.value = sign * best;
+    return result;
+}
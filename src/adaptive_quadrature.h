@@ -0,0 +1,50 @@
+#ifndef ADAPTIVE_QUADRATURE_H
+#define ADAPTIVE_QUADRATURE_H
+
+#include <functional>
+#include <cstddef>
+
+enum class QuadratureRule {
+    AdaptiveSimpson, // Bisection lokal: evaluasi terkumpul di bagian kurva yang kasar
+    Romberg          // Ekstrapolasi Richardson atas trapesium 2^k interval (kurva mulus)
+};
+
+struct QuadratureOptions {
+    double absolute_tolerance;
+    double relative_tolerance;   // Relatif terhadap |integral|; dipakai yang lebih longgar
+    int max_depth;               // Adaptive Simpson: kedalaman bisection maksimum
+    int min_depth;               // Bisection minimum agar pola periodik tidak "lolos" sampling
+    int max_romberg_levels;      // Romberg: maksimum 2^levels interval
+    size_t max_evaluations;
+
+    QuadratureOptions()
+        : absolute_tolerance(1e-6), relative_tolerance(1e-9), max_depth(50), min_depth(4),
+          max_romberg_levels(20), max_evaluations(10000000) {}
+};
+
+struct QuadratureResult {
+    double value;
+    double error_estimate;  // Estimasi |galat| absolut yang tercapai
+    size_t evaluations;     // Jumlah pemanggilan fungsi
+    bool converged;         // false jika batas kedalaman/evaluasi tercapai lebih dulu
+
+    QuadratureResult() : value(0.0), error_estimate(0.0), evaluations(0), converged(true) {}
+};
+
+// Kuadratur adaptif untuk fungsi kontinu (interpolant, model dinamika).
+// Batas terbalik (a > b) menghasilkan integral bertanda negatif.
+class AdaptiveQuadrature {
+public:
+    typedef std::function<double(double)> Integrand;
+
+    static QuadratureResult integrate(const Integrand& f, double a, double b, QuadratureRule rule,
+                                      const QuadratureOptions& options = QuadratureOptions());
+    static QuadratureResult simpson(const Integrand& f, double a, double b,
+                                    const QuadratureOptions& options = QuadratureOptions());
+    static QuadratureResult romberg(const Integrand& f, double a, double b,
+                                    const QuadratureOptions& options = QuadratureOptions());
+
+    static const char* ruleName(QuadratureRule rule);
+};
+
+#endif // ADAPTIVE_QUADRATURE_H
@@ -0,0 +1,128 @@
+#include "analysis_report.h"
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+void AnalysisReport::printGradients(std::ostream& out, const GradientResult& result) {
+    out << "\n=== ANALISIS GRADIENT BANDWIDTH ===\n";
+    out << "Jam\tBandwidth\tGradient\tCurvature\n";
+    out << "---\t---------\t--------\t---------\n";
+
+    for (size_t i = 0; i < result.bandwidth.size(); i++) {
+        out << std::fixed << std::setprecision(0) << result.time_hours[i]
+            << "\t" << std::setprecision(3) << result.bandwidth[i]
+            << "\t\t" << result.gradient[i]
+            << "\t\t" << result.curvature[i] << "\n";
+    }
+}
+
+void AnalysisReport::printPeaks(std::ostream& out, const EventResult& result) {
+    out << "\n=== DETEKSI PEAK TRAFFIC ===\n";
+    for (const TrafficEvent& peak : result.events) {
+        out << "Peak terdeteksi pada jam " << peak.hour
+            << ":00 dengan bandwidth " << peak.bandwidth_mbps << " Mbps\n";
+    }
+}
+
+void AnalysisReport::printAnomalies(std::ostream& out, const EventResult& result) {
+    out << "\n=== DETEKSI ANOMALI TRAFFIC ===\n";
+    out << "Threshold gradient: " << result.threshold << " Mbps/jam\n";
+    for (const TrafficEvent& anomaly : result.events) {
+        out << "Anomali pada jam " << anomaly.hour
+            << ":00 - Gradient: " << anomaly.gradient << " Mbps/jam\n";
+    }
+}
+
+const char* AnalysisReport::periodLabel(int hour) {
+    if (hour >= 0 && hour <= 5) return "Malam (rendah)";
+    if (hour >= 6 && hour <= 11) return "Pagi (meningkat)";
+    if (hour >= 12 && hour <= 17) return "Siang (tinggi)";
+    return "Sore (menurun)";
+}
+
+void AnalysisReport::printForecast(std::ostream& out, const ForecastResult& result) {
+    out << "\n=== PREDIKSI RK4 - 24 JAM KE DEPAN ===\n";
+    out << "Jam\tPrediksi (Mbps)\tInterpretasi\n";
+    out << "---\t---------------\t-----------\n";
+
+    for (size_t k = 0; k < result.predictions.size(); k++) {
+        double hour = k * result.step_hours;
+        out << std::fixed << std::setprecision(result.step_hours == 1.0 ? 0 : 2) << hour
+            << "\t" << std::setprecision(3) << result.predictions[k]
+            << "\t\t" << periodLabel(static_cast<int>(std::fmod(hour, 24.0))) << "\n";
+    }
+}
+
+void AnalysisReport::printEnsembleForecast(std::ostream& out, const EnsembleForecastResult& result) {
+    out << "\n=== ENSEMBLE RK4 - PITA KEPERCAYAAN ===\n";
+    out << "Anggota: " << result.members << ", waktu komputasi: " << std::fixed << std::setprecision(3)
+        << result.seconds << " detik\n";
+    out << "Jam\tP5\tP50\tP95 (Mbps)\n";
+    out << "---\t--\t---\t---\n";
+
+    // Horizon panjang diringkas per 6 jam; file CSV tetap berisi semua titik
+    size_t stride = 1;
+    if (result.p50.size() > 25) stride = std::max<size_t>(1, static_cast<size_t>(std::lround(6.0 / result.step_hours)));
+    for (size_t k = 0; k < result.p50.size(); k += stride) {
+        out << std::fixed << std::setprecision(result.step_hours == 1.0 ? 0 : 2) << k * result.step_hours
+            << "\t" << std::setprecision(3) << result.p5[k] << "\t" << result.p50[k] << "\t" << result.p95[k] << "\n";
+    }
+}
+
+void AnalysisReport::printCalibration(std::ostream& out, const std::vector<CalibrationResult>& results) {
+    out << "\n=== KALIBRASI MODEL (LEVENBERG-MARQUARDT) ===\n";
+    out << "Deret\t\tDecay\tAmpl.\tPhase\tBaseline\tRMSE awal\tRMSE akhir\tIterasi\n";
+    out << "-----\t\t-----\t-----\t-----\t--------\t---------\t----------\t-------\n";
+    for (const CalibrationResult& result : results) {
+        // Format umum: deret ber-skala kbps tetap terbaca (mis. 8.5e-05)
+        out.unsetf(std::ios::floatfield);
+        out << result.label << (result.label.size() < 8 ? "\t\t" : "\t") << std::setprecision(4)
+            << result.params.decay << "\t" << std::setprecision(3) << result.params.amplitude << "\t"
+            << result.params.phase << "\t" << result.params.baseline << "\t\t" << result.initial_rmse << "\t\t"
+            << result.rmse << "\t\t" << result.iterations << (result.converged ? "" : " (belum konvergen)") << "\n";
+    }
+}
+
+const char* AnalysisReport::volatilityStatus(double volatility) {
+    if (volatility < 0.3) return "Traffic stabil";
+    if (volatility < 0.6) return "Traffic moderat";
+    return "Traffic sangat variabel";
+}
+
+void AnalysisReport::printVolatility(std::ostream& out, double volatility) {
+    out << "\n=== ANALISIS VOLATILITY ===\n";
+    out << "Traffic Volatility Index: " << std::fixed << std::setprecision(3) << volatility << "\n";
+    out << "Status: " << volatilityStatus(volatility) << "\n";
+}
+
+void AnalysisReport::printComparison(std::ostream& out, const std::vector<MethodComparisonRow>& rows) {
+    out << "\n=== PERBANDINGAN METODE PREDIKSI ===\n";
+    out << "Waktu\tLagrange\tRK4\t\tSelisih\n";
+    out << "-----\t--------\t---\t\t-------\n";
+
+    for (const MethodComparisonRow& row : rows) {
+        out << std::fixed << std::setprecision(1) << row.time
+            << "\t" << std::setprecision(3) << row.lagrange
+            << "\t\t" << row.rk4
+            << "\t\t" << row.difference << "\n";
+    }
+
+    out << "\nKesimpulan:\n";
+    out << "- Lagrange: Baik untuk interpolasi dalam rentang data\n";
+    out << "- RK4: Lebih akurat untuk prediksi jangka panjang\n";
+}
+
+void AnalysisReport::printEnhancedAnalysis(std::ostream& out, const EnhancedAnalysisResult& result) {
+    out << "\n" << std::string(60, '=') << "\n";
+    out << "        ANALISIS ENHANCED DENGAN METHOD B\n";
+    out << std::string(60, '=') << "\n";
+
+    printGradients(out, result.gradients);
+    printPeaks(out, result.peaks);
+    printAnomalies(out, result.anomalies);
+    printVolatility(out, result.volatility);
+    printForecast(out, result.forecast);
+    printComparison(out, result.comparison);
+    out.flush();
+}
@@ -0,0 +1,25 @@
+#ifndef ANALYSIS_REPORT_H
+#define ANALYSIS_REPORT_H
+
+#include <ostream>
+#include "analysis_results.h"
+
+// Lapisan pemformatan untuk hasil analisis. Setiap baris diakhiri '\n'
+// (bukan std::endl) sehingga tabel panjang tidak di-flush per baris.
+class AnalysisReport {
+public:
+    static void printGradients(std::ostream& out, const GradientResult& result);
+    static void printPeaks(std::ostream& out, const EventResult& result);
+    static void printAnomalies(std::ostream& out, const EventResult& result);
+    static void printForecast(std::ostream& out, const ForecastResult& result);
+    static void printVolatility(std::ostream& out, double volatility);
+    static void printEnsembleForecast(std::ostream& out, const EnsembleForecastResult& result);
+    static void printCalibration(std::ostream& out, const std::vector<CalibrationResult>& results);
+    static void printComparison(std::ostream& out, const std::vector<MethodComparisonRow>& rows);
+    static void printEnhancedAnalysis(std::ostream& out, const EnhancedAnalysisResult& result);
+
+    static const char* periodLabel(int hour);          // Interpretasi jam prediksi
+    static const char* volatilityStatus(double volatility);
+};
+
+#endif // ANALYSIS_REPORT_H
@@ -0,0 +1,101 @@
+#ifndef ANALYSIS_RESULTS_H
+#define ANALYSIS_RESULTS_H
+
+#include <vector>
+#include <cstddef>
+#include <string>
+#include "traffic_model.h"
+
+// Hasil terstruktur analisis Method B. Dihasilkan oleh API komputasi
+// EnhancedNetworkAnalyzer yang tidak mencetak apa pun; pemformatan ke
+// terminal dilakukan terpisah oleh AnalysisReport (opsional).
+
+struct GradientResult {
+    std::vector<double> time_hours;
+    std::vector<double> bandwidth;
+    std::vector<double> gradient;   // Mbps/jam (central difference)
+    std::vector<double> curvature;  // Mbps/jam^2 (turunan kedua)
+};
+
+struct TrafficEvent {
+    int index;             // Indeks pada deret time_hours/bandwidth
+    double hour;
+    double bandwidth_mbps;
+    double gradient;
+};
+
+struct EventResult {
+    double threshold;      // Ambang yang dipakai: prominence minimum (Mbps) untuk
+                           // peak, |gradient| (Mbps/jam) untuk anomali
+    std::vector<TrafficEvent> events;
+
+    EventResult() : threshold(0.0) {}
+
+    std::vector<int> indices() const {
+        std::vector<int> result(events.size());
+        for (size_t i = 0; i < events.size(); i++) result[i] = events[i].index;
+        return result;
+    }
+};
+
+struct ForecastResult {
+    double start_hour;                // Jam awal prediksi (24 = hari berikutnya)
+    double step_hours;                // Jarak antar titik prediksi
+    double initial_bandwidth;         // Kondisi awal (titik terakhir deret)
+    std::vector<double> predictions;  // predictions[k] = bandwidth pada start_hour + k * step_hours
+    size_t model_evaluations;         // Pemanggilan trafficDynamicsModel oleh integrator
+
+    ForecastResult() : start_hour(0.0), step_hours(1.0), initial_bandwidth(0.0), model_evaluations(0) {}
+};
+
+// Pita kepercayaan ensemble: persentil lintas anggota per jam prediksi,
+// p5[k] dst. pada start_hour + k * step_hours
+struct EnsembleForecastResult {
+    double start_hour;
+    double step_hours;
+    size_t members;
+    std::vector<double> p5;
+    std::vector<double> p50;
+    std::vector<double> p95;
+    std::vector<double> mean;
+    double seconds;  // Waktu komputasi (integrasi + persentil)
+
+    EnsembleForecastResult() : start_hour(0.0), step_hours(1.0), members(0), seconds(0.0) {}
+};
+
+// Hasil kalibrasi model dinamika ke satu deret observasi
+struct CalibrationResult {
+    std::string label;           // Nama deret (mis. "Semua hari", "Senin")
+    TrafficModelParams params;
+    double initial_value;        // B(t0) hasil fit
+    double initial_rmse;         // RMSE tebakan awal
+    double rmse;                 // RMSE setelah fit
+    size_t points;
+    size_t iterations;
+    size_t trajectory_evaluations;
+    bool converged;
+
+    CalibrationResult()
+        : initial_value(0.0), initial_rmse(0.0), rmse(0.0), points(0), iterations(0),
+          trajectory_evaluations(0), converged(false) {}
+};
+
+struct MethodComparisonRow {
+    double time;
+    double lagrange;
+    double rk4;
+    double difference;
+};
+
+struct EnhancedAnalysisResult {
+    GradientResult gradients;
+    EventResult peaks;
+    EventResult anomalies;
+    double volatility;
+    ForecastResult forecast;
+    std::vector<MethodComparisonRow> comparison;
+
+    EnhancedAnalysisResult() : volatility(0.0) {}
+};
+
+#endif // ANALYSIS_RESULTS_H
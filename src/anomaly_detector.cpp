@@ -0,0 +1,130 @@
+#include "anomaly_detector.h"
+#include <algorithm>
+#include <cmath>
+
+StreamingAnomalyDetector::StreamingAnomalyDetector(const AnomalyDetectorOptions& detector_options)
+    : options(detector_options), total_samples(0) {
+    if (!(options.alpha > 0.0) || options.alpha > 1.0) options.alpha = AnomalyDetectorOptions().alpha;
+}
+
+void StreamingAnomalyDetector::clear() {
+    means.clear();
+    variances.clear();
+    counts.clear();
+    ring.clear();
+    sorted.clear();
+    events.clear();
+    total_samples = 0;
+}
+
+void StreamingAnomalyDetector::ensureSeries(uint32_t series) {
+    if (series < means.size()) return;
+    size_t size = static_cast<size_t>(series) + 1;
+    means.resize(size, 0.0);
+    variances.resize(size, 0.0);
+    counts.resize(size, 0);
+    if (options.mad_window > 0) {
+        ring.resize(size * options.mad_window, 0.0);
+        sorted.resize(size * options.mad_window, 0.0);
+    }
+}
+
+double StreamingAnomalyDetector::stddev(uint32_t series) const {
+    return series < variances.size() ? std::sqrt(variances[series]) : 0.0;
+}
+
+void StreamingAnomalyDetector::pushWindow(uint32_t series, double value) {
+    // Ring buffer menyimpan urutan waktu, 'sorted' menyimpan isi jendela
+    // yang sama dalam urutan naik (hapus nilai tertua, sisipkan yang baru)
+    size_t w = options.mad_window;
+    double* window = &ring[series * w];
+    double* ordered = &sorted[series * w];
+    size_t filled = static_cast<size_t>(std::min<uint64_t>(counts[series], w));
+    size_t slot = static_cast<size_t>(counts[series] % w);
+
+    if (filled == w) {
+        double oldest = window[slot];
+        double* position = std::lower_bound(ordered, ordered + filled, oldest);
+        std::copy(position + 1, ordered + filled, position);
+        filled--;
+    }
+    double* insert_at = std::upper_bound(ordered, ordered + filled, value);
+    std::copy_backward(insert_at, ordered + filled, ordered + filled + 1);
+    *insert_at = value;
+    window[slot] = value;
+}
+
+bool StreamingAnomalyDetector::robustScore(uint32_t series, double value, double& score) {
+    size_t w = options.mad_window;
+    size_t filled = static_cast<size_t>(std::min<uint64_t>(counts[series], w));
+    if (filled < 3) return false;
+
+    const double* ordered = &sorted[series * w];
+    double median = (filled % 2 == 1) ? ordered[filled / 2]
+                                      : (ordered[filled / 2 - 1] + ordered[filled / 2]) / 2.0;
+    scratch.resize(filled);
+    for (size_t i = 0; i < filled; i++) scratch[i] = std::fabs(ordered[i] - median);
+    std::nth_element(scratch.begin(), scratch.begin() + filled / 2, scratch.end());
+    double mad = scratch[filled / 2];
+    if (mad <= 0.0) {
+        // Jendela datar: setiap nilai berbeda dianggap menyimpang penuh
+        score = (value == median) ? 0.0 : (value > median ? HUGE_VAL : -HUGE_VAL);
+        return true;
+    }
+    score = 0.6745 * (value - median) / mad;
+    return true;
+}
+
+bool StreamingAnomalyDetector::update(uint32_t series, int64_t interval_id, double value) {
+    ensureSeries(series);
+    total_samples++;
+    uint64_t seen = counts[series];
+    double mean_before = means[series];
+    double variance_before = variances[series];
+
+    bool flagged = false;
+    double z = 0.0, robust = 0.0;
+    if (seen == 0) {
+        means[series] = value;
+    } else {
+        double sd = std::sqrt(variance_before);
+        if (sd > 0.0) z = (value - mean_before) / sd;
+        bool warm = seen >= options.warmup;
+        bool ewma_flag = warm && sd > 0.0 && std::fabs(z) > options.z_threshold;
+
+        // MAD hanya dihitung saat dibutuhkan: konfirmasi kandidat EWMA,
+        // atau sebagai detektor utama selama varians EWMA belum ada
+        bool robust_flag = false;
+        if (options.mad_window > 0 && warm && (ewma_flag || sd == 0.0)) {
+            if (robustScore(series, value, robust)) robust_flag = std::fabs(robust) > options.mad_threshold;
+            if (ewma_flag && !robust_flag) ewma_flag = false; // MAD menolak: fluktuasi wajar
+        }
+        flagged = ewma_flag || robust_flag;
+
+        double update_value = value;
+        if (flagged && sd > 0.0) {
+            double limit = options.z_threshold * sd;
+            update_value = std::max(mean_before - limit, std::min(mean_before + limit, value));
+        }
+        // EWMA mean/varians (West): var = (1 - a) * (var + a * diff^2)
+        double diff = update_value - mean_before;
+        double increment = options.alpha * diff;
+        means[series] = mean_before + increment;
+        variances[series] = (1.0 - options.alpha) * (variance_before + diff * increment);
+    }
+
+    if (options.mad_window > 0) pushWindow(series, value);
+    counts[series] = seen + 1;
+
+    if (flagged) {
+        AnomalyEvent event;
+        event.series = series;
+        event.interval_id = interval_id;
+        event.value = value;
+        event.expected = mean_before;
+        event.z_score = z;
+        event.robust_score = robust;
+        events.push_back(event);
+    }
+    return flagged;
+}
@@ -0,0 +1,70 @@
+#ifndef ANOMALY_DETECTOR_H
+#define ANOMALY_DETECTOR_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+struct AnomalyDetectorOptions {
+    double alpha;            // Bobot EWMA sampel baru (0, 1]
+    double z_threshold;      // |z| EWMA di atas ini ditandai anomali
+    size_t warmup;           // Sampel awal per deret yang tidak pernah ditandai
+    size_t mad_window;       // Jendela MAD robust (0 = nonaktif)
+    double mad_threshold;    // |z| robust = 0.6745 * |x - median| / MAD
+
+    AnomalyDetectorOptions()
+        : alpha(0.1), z_threshold(3.5), warmup(12), mad_window(0), mad_threshold(3.5) {}
+};
+
+struct AnomalyEvent {
+    uint32_t series;
+    int64_t interval_id;
+    double value;
+    double expected;      // Rata-rata EWMA sebelum sampel ini
+    double z_score;       // Terhadap EWMA (bertanda)
+    double robust_score;  // Terhadap median/MAD jendela (0 jika nonaktif)
+};
+
+// Detektor anomali online untuk banyak deret independen (mis. per link,
+// per metrik). Setiap deret menyimpan rata-rata dan varians EWMA dalam
+// array SoA sehingga update O(1) dan ribuan deret muat di cache. Skor
+// dihitung terhadap statistik sebelum sampel masuk; sampel yang ditandai
+// dipotong ke mean +- z_threshold * std sebelum memperbarui EWMA agar satu
+// lonjakan tidak menggeser baseline.
+// MAD opsional memakai ring buffer plus salinan terurut per deret
+// (update O(w), w = mad_window). Median/MAD hanya dihitung untuk kandidat
+// EWMA (kandidat ditolak jika |z| robust di bawah ambang) atau selama
+// varians EWMA masih nol (deret datar).
+class StreamingAnomalyDetector {
+private:
+    AnomalyDetectorOptions options;
+    std::vector<double> means;
+    std::vector<double> variances;
+    std::vector<uint64_t> counts;
+    // Jendela MAD: series * mad_window nilai
+    std::vector<double> ring;
+    std::vector<double> sorted;
+    std::vector<double> scratch;
+    std::vector<AnomalyEvent> events;
+    uint64_t total_samples;
+
+    void ensureSeries(uint32_t series);
+    void pushWindow(uint32_t series, double value);
+    bool robustScore(uint32_t series, double value, double& score);
+
+public:
+    explicit StreamingAnomalyDetector(const AnomalyDetectorOptions& detector_options = AnomalyDetectorOptions());
+
+    // Tambah satu sampel; true jika ditandai anomali (dicatat di events())
+    bool update(uint32_t series, int64_t interval_id, double value);
+    void clear();
+
+    size_t seriesCount() const { return means.size(); }
+    uint64_t sampleCount() const { return total_samples; }
+    double mean(uint32_t series) const { return series < means.size() ? means[series] : 0.0; }
+    double stddev(uint32_t series) const;
+    const std::vector<AnomalyEvent>& getEvents() const { return events; }
+    const AnomalyDetectorOptions& getOptions() const { return options; }
+};
+
+#endif // ANOMALY_DETECTOR_H
@@ -0,0 +1,125 @@
+#include "columnar_store.h"
+#include <fstream>
+#include <cstring>
+
+namespace columnar {
+
+static size_t alignUp(size_t value) {
+    return (value + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT;
+}
+
+bool isColumnarFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(MAGIC)];
+    if (!file.read(magic, sizeof(magic))) return false;
+    return std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+void ColumnarWriter::addColumn(const std::string& name, const double* values, size_t count) {
+    PendingColumn column = {name, COLUMN_FLOAT64, values, count};
+    columns.push_back(column);
+}
+
+void ColumnarWriter::addColumn(const std::string& name, const int64_t* values, size_t count) {
+    PendingColumn column = {name, COLUMN_INT64, values, count};
+    columns.push_back(column);
+}
+
+bool ColumnarWriter::write(const std::string& filename) const {
+    // Susun direktori kolom dan offset data
+    std::vector<ColumnDescriptor> descriptors(columns.size());
+    size_t offset = alignUp(sizeof(ColumnarHeader) + columns.size() * sizeof(ColumnDescriptor));
+
+    for (size_t i = 0; i < columns.size(); i++) {
+        if (columns[i].name.size() > MAX_NAME_LENGTH) return false;
+        ColumnDescriptor& desc = descriptors[i];
+        std::memset(&desc, 0, sizeof(desc));
+        std::memcpy(desc.name, columns[i].name.data(), columns[i].name.size());
+        desc.type = columns[i].type;
+        desc.offset = offset;
+        desc.count = columns[i].count;
+        offset = alignUp(offset + columns[i].count * 8); // float64 & int64 sama-sama 8 byte
+    }
+
+    ColumnarHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.endian_marker = ENDIAN_MARKER;
+    header.column_count = static_cast<uint32_t>(columns.size());
+    header.file_size = offset;
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return false;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!descriptors.empty()) {
+        out.write(reinterpret_cast<const char*>(descriptors.data()),
+                  descriptors.size() * sizeof(ColumnDescriptor));
+    }
+
+    static const char padding[COLUMN_ALIGNMENT] = {0};
+    size_t position = sizeof(header) + descriptors.size() * sizeof(ColumnDescriptor);
+    for (size_t i = 0; i < columns.size(); i++) {
+        out.write(padding, descriptors[i].offset - position);
+        size_t length = columns[i].count * 8;
+        if (length > 0) out.write(static_cast<const char*>(columns[i].values), length);
+        position = descriptors[i].offset + length;
+    }
+    out.write(padding, header.file_size - position);
+
+    return static_cast<bool>(out);
+}
+
+bool ColumnarFile::open(const std::string& filename) {
+    header = nullptr;
+    descriptors = nullptr;
+    if (!file.open(filename)) return false;
+
+    const char* base = file.data();
+    size_t size = file.size();
+    if (size < sizeof(ColumnarHeader)) return false;
+
+    const ColumnarHeader* h = reinterpret_cast<const ColumnarHeader*>(base);
+    if (std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) != 0) return false;
+    if (h->endian_marker != ENDIAN_MARKER) return false;
+    if (h->version != FORMAT_VERSION) return false;
+    if (h->file_size != size) return false;
+    if (sizeof(ColumnarHeader) + h->column_count * sizeof(ColumnDescriptor) > size) return false;
+
+    // Validasi setiap kolom berada di dalam file dan sejajar
+    const ColumnDescriptor* d = reinterpret_cast<const ColumnDescriptor*>(base + sizeof(ColumnarHeader));
+    for (uint32_t i = 0; i < h->column_count; i++) {
+        if (d[i].offset % COLUMN_ALIGNMENT != 0) return false;
+        if (d[i].offset > size || d[i].count > (size - d[i].offset) / 8) return false;
+        if (d[i].name[sizeof(d[i].name) - 1] != '\0') return false;
+    }
+
+    header = h;
+    descriptors = d;
+    return true;
+}
+
+const ColumnDescriptor* ColumnarFile::find(const std::string& name, ColumnType type) const {
+    if (header == nullptr) return nullptr;
+    for (uint32_t i = 0; i < header->column_count; i++) {
+        if (descriptors[i].type == static_cast<uint32_t>(type) && name == descriptors[i].name) {
+            return &descriptors[i];
+        }
+    }
+    return nullptr;
+}
+
+const double* ColumnarFile::float64Column(const std::string& name, size_t& count) const {
+    const ColumnDescriptor* desc = find(name, COLUMN_FLOAT64);
+    count = desc ? static_cast<size_t>(desc->count) : 0;
+    return desc ? reinterpret_cast<const double*>(file.data() + desc->offset) : nullptr;
+}
+
+const int64_t* ColumnarFile::int64Column(const std::string& name, size_t& count) const {
+    const ColumnDescriptor* desc = find(name, COLUMN_INT64);
+    count = desc ? static_cast<size_t>(desc->count) : 0;
+    return desc ? reinterpret_cast<const int64_t*>(file.data() + desc->offset) : nullptr;
+}
+
+} // namespace columnar
@@ -0,0 +1,98 @@
+#ifndef COLUMNAR_STORE_H
+#define COLUMNAR_STORE_H
+
+#include "mapped_file.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Format biner kolumnar untuk deret waktu terproses (.ntcol).
+//
+// Tata letak file (little/big endian mengikuti mesin penulis, dicek lewat
+// penanda endian):
+//   ColumnarHeader                      (32 byte)
+//   ColumnDescriptor[column_count]      (48 byte per kolom)
+//   data kolom, masing-masing dimulai pada offset kelipatan 64 byte
+//
+// Karena data kolom disimpan apa adanya dan sejajar, file bisa
+// dipetakan ke memori lalu dipakai langsung tanpa parsing: membuka file
+// hanya membaca header dan direktori kolom (O(jumlah kolom)).
+namespace columnar {
+
+const char MAGIC[8] = {'N', 'T', 'C', 'O', 'L', 'U', 'M', 'N'};
+const uint32_t FORMAT_VERSION = 1;
+const uint32_t ENDIAN_MARKER = 0x01020304;
+const size_t COLUMN_ALIGNMENT = 64;
+const size_t MAX_NAME_LENGTH = 23;
+
+enum ColumnType {
+    COLUMN_FLOAT64 = 1,
+    COLUMN_INT64 = 2
+};
+
+struct ColumnarHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endian_marker;
+    uint32_t column_count;
+    uint32_t reserved;
+    uint64_t file_size;
+};
+
+struct ColumnDescriptor {
+    char name[24];   // Nama kolom, diakhiri '\0'
+    uint32_t type;   // ColumnType
+    uint32_t reserved;
+    uint64_t offset; // Offset data dari awal file
+    uint64_t count;  // Jumlah elemen
+};
+
+// Cek cepat apakah file diawali magic format kolumnar
+bool isColumnarFile(const std::string& filename);
+
+// Penulis file kolumnar. Kolom hanya direferensikan (tidak disalin)
+// sampai write() dipanggil.
+class ColumnarWriter {
+private:
+    struct PendingColumn {
+        std::string name;
+        ColumnType type;
+        const void* values;
+        size_t count;
+    };
+    std::vector<PendingColumn> columns;
+
+public:
+    void addColumn(const std::string& name, const double* values, size_t count);
+    void addColumn(const std::string& name, const int64_t* values, size_t count);
+    bool write(const std::string& filename) const;
+};
+
+// Pembaca file kolumnar berbasis mmap. Pointer kolom valid selama objek
+// ini hidup.
+class ColumnarFile {
+private:
+    MappedFile file;
+    const ColumnarHeader* header;
+    const ColumnDescriptor* descriptors;
+
+    const ColumnDescriptor* find(const std::string& name, ColumnType type) const;
+
+public:
+    ColumnarFile() : header(nullptr), descriptors(nullptr) {}
+
+    // Petakan dan validasi file; false jika bukan format yang didukung
+    bool open(const std::string& filename);
+
+    uint32_t version() const { return header ? header->version : 0; }
+    uint32_t columnCount() const { return header ? header->column_count : 0; }
+
+    // Mengembalikan nullptr jika kolom tidak ada
+    const double* float64Column(const std::string& name, size_t& count) const;
+    const int64_t* int64Column(const std::string& name, size_t& count) const;
+};
+
+} // namespace columnar
+
+#endif // COLUMNAR_STORE_H
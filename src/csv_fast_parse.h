@@ -0,0 +1,169 @@
+#ifndef CSV_FAST_PARSE_H
+#define CSV_FAST_PARSE_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// Parser CSV tanpa alokasi: semua fungsi bekerja langsung di atas buffer
+// (misalnya hasil MappedFile) dan memajukan pointer p. Tidak ada
+// std::string, std::stringstream, maupun std::stod di jalur panas.
+namespace csvparse {
+
+inline bool isDigit(char c) {
+    return static_cast<unsigned>(c - '0') < 10u;
+}
+
+inline void skipSpaces(const char*& p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '"')) ++p;
+}
+
+// Lompat ke awal field berikutnya (setelah ',') atau berhenti di akhir baris
+inline void skipField(const char*& p, const char* end) {
+    while (p < end && *p != ',' && *p != '\n') ++p;
+    if (p < end && *p == ',') ++p;
+}
+
+// Lompat ke awal baris berikutnya
+inline void skipLine(const char*& p, const char* end) {
+    const void* nl = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    p = nl ? static_cast<const char*>(nl) + 1 : end;
+}
+
+// Ambil field sebagai rentang [begin, end) tanpa menyalin
+inline void fieldRange(const char*& p, const char* end, const char*& field_begin, const char*& field_end) {
+    skipSpaces(p, end);
+    field_begin = p;
+    while (p < end && *p != ',' && *p != '\n') ++p;
+    field_end = p;
+    while (field_end > field_begin &&
+           (field_end[-1] == '\r' || field_end[-1] == ' ' || field_end[-1] == '"')) {
+        --field_end;
+    }
+    if (p < end && *p == ',') ++p;
+}
+
+// Pangkat 10 yang bisa direpresentasikan tepat sebagai double
+inline double exactPow10(int e) {
+    static const double table[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    return table[e];
+}
+
+// Parse double desimal (dengan tanda, pecahan, dan eksponen opsional).
+// Jalur cepat: mantissa < 2^53 dan |eksponen| <= 22 memberikan hasil yang
+// dibulatkan dengan benar (sama seperti strtod). Selain itu jatuh ke strtod
+// pada salinan kecil di stack. Mengembalikan false jika tidak ada digit.
+inline bool parseDouble(const char*& p, const char* end, double& out) {
+    skipSpaces(p, end);
+    const char* start = p;
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool any_digit = false;
+
+    while (p < end && isDigit(*p)) {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+            if (mantissa != 0) ++digits;
+        } else {
+            ++exponent; // Digit di luar presisi hanya menggeser skala
+        }
+        any_digit = true;
+        ++p;
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        while (p < end && isDigit(*p)) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                if (mantissa != 0) ++digits;
+                --exponent;
+            }
+            any_digit = true;
+            ++p;
+        }
+    }
+    if (!any_digit) {
+        p = start;
+        return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char* exp_start = p;
+        ++p;
+        bool exp_negative = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            exp_negative = (*p == '-');
+            ++p;
+        }
+        if (p < end && isDigit(*p)) {
+            int e = 0;
+            while (p < end && isDigit(*p)) {
+                if (e < 100000) e = e * 10 + (*p - '0');
+                ++p;
+            }
+            exponent += exp_negative ? -e : e;
+        } else {
+            p = exp_start; // 'e' tanpa digit bukan bagian dari angka
+        }
+    }
+
+    if (mantissa < (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+        double value = static_cast<double>(mantissa);
+        value = exponent < 0 ? value / exactPow10(-exponent) : value * exactPow10(exponent);
+        out = negative ? -value : value;
+        return true;
+    }
+
+    // Jalur lambat yang jarang: salin ke buffer stack lalu strtod
+    char buffer[64];
+    size_t len = static_cast<size_t>(p - start);
+    if (len >= sizeof(buffer)) len = sizeof(buffer) - 1;
+    std::memcpy(buffer, start, len);
+    buffer[len] = '\0';
+    out = std::strtod(buffer, nullptr);
+    return true;
+}
+
+// Parse bilangan bulat bertanda. Mengembalikan false jika tidak ada digit
+// atau nilainya melewati INT64_MAX (field Length rusak), seperti
+// parseDouble: p dikembalikan ke awal field.
+inline bool parseInt64(const char*& p, const char* end, int64_t& out) {
+    skipSpaces(p, end);
+    const char* start = p;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    if (p >= end || !isDigit(*p)) {
+        p = start;
+        return false;
+    }
+
+    int64_t value = 0;
+    while (p < end && isDigit(*p)) {
+        int digit = *p - '0';
+        if (value > (INT64_MAX - digit) / 10) {
+            p = start;
+            return false;
+        }
+        value = value * 10 + digit;
+        ++p;
+    }
+    out = negative ? -value : value;
+    return true;
+}
+
+} // namespace csvparse
+
+#endif // CSV_FAST_PARSE_H
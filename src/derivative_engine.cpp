@@ -0,0 +1,208 @@
+#include "derivative_engine.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Bobot c sehingga turunan ke-0..2 polinom fit di titik t = sum c[j] * y[j],
+// untuk posisi z[0..count). Menyelesaikan (A^T A) u = g dengan
+// A[j][k] = z[j]^k dan g[k] = d^k/dt^k t^k, lalu c = A u.
+bool fitWeights(const double* z, size_t count, int order, double t, double* const weights[3]) {
+    const int terms = order + 1;
+    double normal[(DerivativeEngine::MAX_ORDER + 1) * (DerivativeEngine::MAX_ORDER + 1)];
+    double rhs[(DerivativeEngine::MAX_ORDER + 1) * 3];
+    double powers[2 * DerivativeEngine::MAX_ORDER + 1];
+
+    for (int r = 0; r < terms * terms; r++) normal[r] = 0.0;
+    for (size_t j = 0; j < count; j++) {
+        powers[0] = 1.0;
+        for (int p = 1; p <= 2 * order; p++) powers[p] = powers[p - 1] * z[j];
+        for (int a = 0; a < terms; a++) {
+            for (int b = 0; b < terms; b++) normal[a * terms + b] += powers[a + b];
+        }
+    }
+
+    // Ruas kanan: turunan ke-d dari t^k untuk d = 0, 1, 2
+    for (int k = 0; k < terms; k++) {
+        for (int d = 0; d < 3; d++) {
+            double value = 0.0;
+            if (k >= d) {
+                double factor = 1.0;
+                for (int m = 0; m < d; m++) factor *= static_cast<double>(k - m);
+                value = factor * std::pow(t, k - d);
+            }
+            rhs[k * 3 + d] = value;
+        }
+    }
+
+    // Eliminasi Gauss dengan pivot parsial (matriks kecil, simetris)
+    for (int col = 0; col < terms; col++) {
+        int pivot = col;
+        for (int r = col + 1; r < terms; r++) {
+            if (std::fabs(normal[r * terms + col]) > std::fabs(normal[pivot * terms + col])) pivot = r;
+        }
+        if (std::fabs(normal[pivot * terms + col]) < 1e-300) return false;
+        if (pivot != col) {
+            for (int c = 0; c < terms; c++) std::swap(normal[col * terms + c], normal[pivot * terms + c]);
+            for (int d = 0; d < 3; d++) std::swap(rhs[col * 3 + d], rhs[pivot * 3 + d]);
+        }
+        for (int r = col + 1; r < terms; r++) {
+            double factor = normal[r * terms + col] / normal[col * terms + col];
+            for (int c = col; c < terms; c++) normal[r * terms + c] -= factor * normal[col * terms + c];
+            for (int d = 0; d < 3; d++) rhs[r * 3 + d] -= factor * rhs[col * 3 + d];
+        }
+    }
+    for (int col = terms - 1; col >= 0; col--) {
+        for (int d = 0; d < 3; d++) {
+            double value = rhs[col * 3 + d];
+            for (int c = col + 1; c < terms; c++) value -= normal[col * terms + c] * rhs[c * 3 + d];
+            rhs[col * 3 + d] = value / normal[col * terms + col];
+        }
+    }
+
+    for (size_t j = 0; j < count; j++) {
+        double sums[3] = {0.0, 0.0, 0.0};
+        double power = 1.0;
+        for (int k = 0; k < terms; k++) {
+            for (int d = 0; d < 3; d++) sums[d] += power * rhs[k * 3 + d];
+            power *= z[j];
+        }
+        for (int d = 0; d < 3; d++) {
+            if (weights[d]) weights[d][j] = sums[d];
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+DerivativeEngine::DerivativeEngine() : half_window(0), order(0) {
+    configure(DEFAULT_HALF_WINDOW, DEFAULT_ORDER);
+}
+
+bool DerivativeEngine::configure(size_t half_window_size, int polynomial_order) {
+    if (polynomial_order < 0 || polynomial_order > MAX_ORDER) return false;
+    if (half_window_size == 0 || half_window_size > MAX_HALF_WINDOW) return false;
+    if (static_cast<size_t>(polynomial_order) >= 2 * half_window_size + 1) return false;
+
+    half_window = half_window_size;
+    order = polynomial_order;
+
+    size_t w = window();
+    std::vector<double> z(w);
+    for (size_t j = 0; j < w; j++) z[j] = static_cast<double>(j) - static_cast<double>(half_window);
+    for (int d = 0; d < 3; d++) coefficients[d].assign(w * w, 0.0);
+
+    // Posisi p di dalam jendela [0, w) dipetakan ke t = p - half_window
+    for (size_t p = 0; p < w; p++) {
+        double* weights[3] = {&coefficients[0][p * w], &coefficients[1][p * w], &coefficients[2][p * w]};
+        fitWeights(z.data(), w, order, static_cast<double>(p) - static_cast<double>(half_window), weights);
+    }
+    return true;
+}
+
+bool DerivativeEngine::isUniform(const double* x, size_t n, double& spacing) {
+    if (n < 2) return false;
+    spacing = (x[n - 1] - x[0]) / static_cast<double>(n - 1);
+    if (!(spacing > 0.0)) return false;
+    double tolerance = spacing * 1e-6; // Pembulatan timestamp besar (jam sejak epoch)
+    for (size_t i = 1; i < n; i++) {
+        if (std::fabs((x[i] - x[i - 1]) - spacing) > tolerance) return false;
+    }
+    return true;
+}
+
+void DerivativeEngine::applyUniform(const double* y, size_t n, double spacing, double* const outputs[3]) const {
+    const size_t w = window();
+    const size_t BLOCK = 256;
+    double scale[3] = {1.0, 1.0 / spacing, 1.0 / (spacing * spacing)};
+
+    for (int d = 0; d < 3; d++) {
+        double* out = outputs[d];
+        if (!out) continue;
+        const std::vector<double>& c = coefficients[d];
+
+        // Ujung: jendela asimetris yang menempel pada awal/akhir deret
+        for (size_t i = 0; i < half_window; i++) {
+            const double* weights = &c[i * w];
+            const double* tail_weights = &c[(w - 1 - i) * w];
+            double head = 0.0, tail = 0.0;
+            for (size_t j = 0; j < w; j++) {
+                head += weights[j] * y[j];
+                tail += tail_weights[j] * y[n - w + j];
+            }
+            out[i] = head * scale[d];
+            out[n - 1 - i] = tail * scale[d];
+        }
+
+        // Interior: stencil pusat, blok BLOCK titik dengan loop j di luar
+        // sehingga loop dalam kontigu dan berjumlah iterasi tetap
+        const double* center = &c[half_window * w];
+        size_t begin = half_window, end = n - half_window;
+        double acc[BLOCK];
+        for (size_t base = begin; base < end; base += BLOCK) {
+            size_t count = std::min(BLOCK, end - base);
+            const double* source = y + base - half_window;
+            if (count == BLOCK) {
+                for (size_t b = 0; b < BLOCK; b++) acc[b] = 0.0;
+                for (size_t j = 0; j < w; j++) {
+                    const double weight = center[j];
+                    const double* row = source + j;
+                    for (size_t b = 0; b < BLOCK; b++) acc[b] += weight * row[b];
+                }
+            } else {
+                for (size_t b = 0; b < count; b++) {
+                    double sum = 0.0;
+                    for (size_t j = 0; j < w; j++) sum += center[j] * source[b + j];
+                    acc[b] = sum;
+                }
+            }
+            for (size_t b = 0; b < count; b++) out[base + b] = acc[b] * scale[d];
+        }
+    }
+}
+
+bool DerivativeEngine::applyGeneral(const double* x, const double* y, size_t n, double* const outputs[3]) const {
+    // Jendela w titik berurutan sedekat mungkin dengan pusat i (digeser di
+    // ujung); posisi dinormalisasi dengan lebar jendela agar matriks normal
+    // tetap terkondisi baik untuk timestamp besar
+    size_t w = std::min(window(), n);
+    size_t half = (w - 1) / 2;
+    std::vector<double> z(w), weights_storage(3 * w);
+    double* weights[3] = {outputs[0] ? &weights_storage[0] : nullptr,
+                          outputs[1] ? &weights_storage[w] : nullptr,
+                          outputs[2] ? &weights_storage[2 * w] : nullptr};
+
+    for (size_t i = 0; i < n; i++) {
+        size_t start = i > half ? i - half : 0;
+        if (start + w > n) start = n - w;
+        double span = (x[start + w - 1] - x[start]) / 2.0;
+        for (size_t j = 0; j < w; j++) z[j] = (x[start + j] - x[i]) / span;
+        if (!fitWeights(z.data(), w, order, 0.0, weights)) return false;
+
+        double scale[3] = {1.0, 1.0 / span, 1.0 / (span * span)};
+        for (int d = 0; d < 3; d++) {
+            if (!outputs[d]) continue;
+            double sum = 0.0;
+            for (size_t j = 0; j < w; j++) sum += weights[d][j] * y[start + j];
+            outputs[d][i] = sum * scale[d];
+        }
+    }
+    return true;
+}
+
+bool DerivativeEngine::compute(const double* x, const double* y, size_t n,
+                               double* smoothed, double* first, double* second) const {
+    if (n < static_cast<size_t>(order) + 1 || n < 2) return false;
+    for (size_t i = 1; i < n; i++) {
+        if (!(x[i] > x[i - 1])) return false; // Juga menolak NaN
+    }
+
+    double* const outputs[3] = {smoothed, first, second};
+    double spacing;
+    if (n >= window() && isUniform(x, n, spacing)) {
+        applyUniform(y, n, spacing, outputs);
+        return true;
+    }
+    return applyGeneral(x, y, n, outputs);
+}
@@ -0,0 +1,52 @@
+#ifndef DERIVATIVE_ENGINE_H
+#define DERIVATIVE_ENGINE_H
+
+#include <vector>
+#include <cstddef>
+
+// Turunan Savitzky-Golay: polinom derajat 'order' di-fit (least squares)
+// pada jendela 2*half_window+1 titik di sekitar setiap titik, lalu nilai,
+// turunan pertama dan kedua polinom di titik itu yang diambil.
+//  - Spasi seragam (kasus deret interval teragregasi): koefisien konvolusi
+//    dihitung sekali di configure(), termasuk jendela asimetris untuk
+//    half_window titik di kedua ujung. Titik interior dihitung dengan
+//    kernel stencil per blok yang divektorisasi compiler.
+//  - Spasi tidak seragam (ada celah/duplikat jarak): fit lokal per titik
+//    dengan posisi x sebenarnya.
+class DerivativeEngine {
+public:
+    static const size_t DEFAULT_HALF_WINDOW = 3;
+    static const int DEFAULT_ORDER = 2;
+    static const size_t MAX_HALF_WINDOW = 64;
+    static const int MAX_ORDER = 6;
+
+private:
+    size_t half_window;
+    int order;
+    // coefficients[d][p * window + j]: bobot y[start + j] untuk turunan ke-d
+    // di posisi p jendela (p = half_window adalah stencil pusat), satuan sampel
+    std::vector<double> coefficients[3];
+
+    size_t window() const { return 2 * half_window + 1; }
+    void applyUniform(const double* y, size_t n, double spacing, double* const outputs[3]) const;
+    bool applyGeneral(const double* x, const double* y, size_t n, double* const outputs[3]) const;
+
+public:
+    DerivativeEngine();
+
+    // false jika order < 0, order > MAX_ORDER, atau order >= jendela
+    bool configure(size_t half_window_size, int polynomial_order);
+
+    // x harus naik tegas, n >= order + 1. Output boleh nullptr jika tidak
+    // dibutuhkan: smoothed (nilai fit), first (dy/dx), second (d2y/dx2).
+    bool compute(const double* x, const double* y, size_t n,
+                 double* smoothed, double* first, double* second) const;
+
+    size_t getHalfWindow() const { return half_window; }
+    int getOrder() const { return order; }
+
+    // true jika semua jarak x sama (toleransi relatif 1e-6); spacing = jarak
+    static bool isUniform(const double* x, size_t n, double& spacing);
+};
+
+#endif // DERIVATIVE_ENGINE_H
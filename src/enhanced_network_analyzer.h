@@ -3,199 +3,327 @@
 #define ENHANCED_NETWORK_ANALYZER_H
 
 #include "network_analyzer.h"
+#include "analysis_results.h"
+#include "analysis_report.h"
 #include <cmath>
 
 class EnhancedNetworkAnalyzer : public NetworkAnalyzer {
 private:
     std::vector<double> gradients;
     std::vector<double> second_derivatives;
+    unsigned long gradient_revision; // series_revision saat cache gradient diisi
+    OdeOptions forecast_options; // Integrator untuk semua prediksi model
+    TrafficModelRegistry models; // Model dinamika aktif + parameter setiap jenis
+    
+    // Visitor untuk TrafficModelRegistry::dispatch: switch sekali, lalu
+    // integrator/turunan dispesialisasi untuk tipe model konkret
+    struct DerivativeAt {
+        typedef double result_type;
+        double t, bandwidth;
+        template <typename Model>
+        double operator()(const Model& model) const { return model(t, bandwidth); }
+    };
+    
+    struct TrajectoryRun {
+        typedef DenseTrajectory result_type;
+        double t0, y0, t_end;
+        const OdeOptions* options;
+        OdeStats* stats;
+        template <typename Model>
+        DenseTrajectory operator()(const Model& model) const {
+            return OdeIntegrator::integrate(model, t0, y0, t_end, *options, stats);
+        }
+    };
+    
+    struct EnsembleRun {
+        typedef EnsembleForecastResult result_type;
+        double start_hour, initial_bandwidth;
+        const EnsembleOptions* options;
+        template <typename Model>
+        EnsembleForecastResult operator()(const Model& model) const {
+            return EnsembleForecaster::run(model, start_hour, initial_bandwidth, *options);
+        }
+    };
+    
+    TrafficEvent eventAt(size_t index) const {
+        TrafficEvent event;
+        event.index = static_cast<int>(index);
+        event.hour = time_hours[index];
+        event.bandwidth_mbps = bandwidth[index];
+        event.gradient = gradients[index];
+        return event;
+    }
     
 public:
+    EnhancedNetworkAnalyzer() : gradient_revision(0) {
+        // Dormand-Prince adaptif; langkah awal 0.1 jam seperti RK4 lama
+        forecast_options.floor_value = 0.1;
+    }
+    
+    // API komputasi (compute*/find*/forecast*/analyze) tidak mencetak apa pun
+    // dan mengembalikan struct hasil; method lama (calculateGradients,
+    // detectTrafficPeaks, ...) adalah pembungkus yang mencetak lewat
+    // AnalysisReport.
+    
     // METHOD B - PART 6: NUMERICAL DIFFERENTIATION
     
+    // Semua selisih memakai jarak time_hours sebenarnya (tidak harus 1 jam)
+    
     // Forward difference untuk menghitung gradient bandwidth
     double forwardDifference(int index) {
-        if (index >= bandwidth.size() - 1) return 0.0;
-        return (bandwidth[index + 1] - bandwidth[index]) / 1.0; // h = 1 jam
+        if (index < 0 || index + 1 >= static_cast<int>(bandwidth.size())) return 0.0;
+        return (bandwidth[index + 1] - bandwidth[index]) / (time_hours[index + 1] - time_hours[index]);
     }
     
     // Central difference untuk akurasi lebih tinggi
     double centralDifference(int index) {
-        if (index <= 0 || index >= bandwidth.size() - 1) return 0.0;
-        return (bandwidth[index + 1] - bandwidth[index - 1]) / 2.0; // h = 1 jam
+        if (index <= 0 || index + 1 >= static_cast<int>(bandwidth.size())) return 0.0;
+        return (bandwidth[index + 1] - bandwidth[index - 1]) / (time_hours[index + 1] - time_hours[index - 1]);
     }
     
-    // Second derivative untuk analisis curvature
+    // Second derivative untuk analisis curvature (rumus tiga titik tidak seragam)
     double secondDerivative(int index) {
-        if (index <= 0 || index >= bandwidth.size() - 1) return 0.0;
-        return (bandwidth[index + 1] - 2*bandwidth[index] + bandwidth[index - 1]) / 1.0;
+        if (index <= 0 || index + 1 >= static_cast<int>(bandwidth.size())) return 0.0;
+        double h0 = time_hours[index] - time_hours[index - 1];
+        double h1 = time_hours[index + 1] - time_hours[index];
+        return 2.0 * (h0 * bandwidth[index + 1] - (h0 + h1) * bandwidth[index] + h1 * bandwidth[index - 1])
+               / (h0 * h1 * (h0 + h1));
     }
     
-    // Analisis rate of change untuk seluruh data
-    void calculateGradients() {
-        gradients.clear();
-        second_derivatives.clear();
+    // Isi ulang cache gradient & curvature bila deret berubah sejak terakhir
+    // dihitung (muat ulang, append, atau deret baru dengan panjang sama)
+    void ensureGradients() {
+        if (gradient_revision == series_revision && gradients.size() == bandwidth.size()) return;
+        gradients.resize(bandwidth.size());
+        second_derivatives.resize(bandwidth.size());
         
         for (size_t i = 0; i < bandwidth.size(); i++) {
-            gradients.push_back(centralDifference(i));
-            second_derivatives.push_back(secondDerivative(i));
+            gradients[i] = centralDifference(static_cast<int>(i));
+            second_derivatives[i] = secondDerivative(static_cast<int>(i));
+        }
+        gradient_revision = series_revision;
+    }
+    
+    // Hitung gradient & curvature seluruh deret (senyap)
+    GradientResult computeGradients() {
+        ensureGradients();
+        
+        GradientResult result;
+        result.time_hours = time_hours.toVector();
+        result.bandwidth = bandwidth.toVector();
+        result.gradient = gradients;
+        result.curvature = second_derivatives;
+        return result;
+    }
+    
+    // Analisis rate of change untuk seluruh data
+    void calculateGradients() {
+        AnalysisReport::printGradients(std::cout, computeGradients());
+        std::cout.flush();
+    }
+    
+    // Gradient Savitzky-Golay pada deret resolusi penuh (timestamp asli)
+    bool analyzeSmoothedGradients(size_t half_window = DerivativeEngine::DEFAULT_HALF_WINDOW,
+                                  int order = DerivativeEngine::DEFAULT_ORDER) {
+        std::vector<double> hours, smoothed, gradient, curvature;
+        if (!computeDerivatives(half_window, order, hours, smoothed, gradient, curvature)) return false;
+        
+        size_t rise = 0, fall = 0;
+        double sum_squares = 0.0;
+        for (size_t i = 0; i < gradient.size(); i++) {
+            if (gradient[i] > gradient[rise]) rise = i;
+            if (gradient[i] < gradient[fall]) fall = i;
+            sum_squares += gradient[i] * gradient[i];
         }
         
-        std::cout << "\n=== ANALISIS GRADIENT BANDWIDTH ===" << std::endl;
-        std::cout << "Jam\tBandwidth\tGradient\tCurvature" << std::endl;
-        std::cout << "---\t---------\t--------\t---------" << std::endl;
-        
-        for (size_t i = 0; i < bandwidth.size(); i++) {
-            std::cout << std::fixed << std::setprecision(0) << time_hours[i] 
-                      << "\t" << std::setprecision(3) << bandwidth[i]
-                      << "\t\t" << gradients[i]
-                      << "\t\t" << second_derivatives[i] << std::endl;
+        std::cout << "\n=== GRADIENT SAVITZKY-GOLAY (RESOLUSI PENUH) ===" << std::endl;
+        std::cout << "Titik: " << hours.size() << ", jendela " << 2 * half_window + 1
+                  << " titik, polinom orde " << order << std::endl;
+        std::cout << std::fixed << std::setprecision(3)
+                  << "Kenaikan tercepat: " << gradient[rise] << " Mbps/jam pada jam "
+                  << std::fmod(hours[rise], 24.0) << " (UTC)" << std::endl;
+        std::cout << "Penurunan tercepat: " << gradient[fall] << " Mbps/jam pada jam "
+                  << std::fmod(hours[fall], 24.0) << " (UTC)" << std::endl;
+        std::cout << "RMS gradient: " << std::sqrt(sum_squares / gradient.size()) << " Mbps/jam" << std::endl;
+        return true;
+    }
+    
+    // Peak: maksimum lokal dengan prominence >= min_prominence_ratio x
+    // rentang bandwidth (senyap). Tidak bergantung pada ambang gradient
+    // absolut sehingga berlaku untuk skala dan panjang deret apa pun.
+    EventResult findTrafficPeaks(double min_prominence_ratio = 0.1) {
+        ensureGradients();
+        
+        EventResult result;
+        PeakOptions options;
+        options.min_prominence = min_prominence_ratio * (getMaxBandwidth() - getMinBandwidth());
+        result.threshold = options.min_prominence;
+        for (const Peak& peak : PeakFinder::find(bandwidth.data(), bandwidth.size(), options)) {
+            result.events.push_back(eventAt(peak.index));
         }
+        return result;
     }
     
     // Deteksi peak traffic berdasarkan derivative
     std::vector<int> detectTrafficPeaks() {
-        if (gradients.empty()) calculateGradients();
-        
-        std::vector<int> peaks;
+        EventResult result = findTrafficPeaks();
+        AnalysisReport::printPeaks(std::cout, result);
+        std::cout.flush();
+        return result.indices();
+    }
+    
+    // Anomali: |gradient| melebihi threshold (senyap)
+    EventResult findAnomalies(double threshold = 0.8) {
+        ensureGradients();
         
-        for (size_t i = 1; i < gradients.size() - 1; i++) {
-            // Peak condition: gradient berubah dari positif ke negatif
-            if (gradients[i-1] > 0.05 && gradients[i+1] < -0.05 && 
-                abs(gradients[i]) < 0.1) {
-                peaks.push_back(i);
+        EventResult result;
+        result.threshold = threshold;
+        for (size_t i = 0; i < gradients.size(); i++) {
+            if (std::fabs(gradients[i]) > threshold) {
+                result.events.push_back(eventAt(i));
             }
         }
-        
-        std::cout << "\n=== DETEKSI PEAK TRAFFIC ===" << std::endl;
-        for (int peak : peaks) {
-            std::cout << "Peak terdeteksi pada jam " << time_hours[peak] 
-                      << ":00 dengan bandwidth " << bandwidth[peak] << " Mbps" << std::endl;
-        }
-        
-        return peaks;
+        return result;
     }
     
     // Deteksi anomali berdasarkan gradient threshold
     std::vector<int> detectAnomalies(double threshold = 0.8) {
-        if (gradients.empty()) calculateGradients();
-        
-        std::vector<int> anomalies;
-        
-        for (size_t i = 0; i < gradients.size(); i++) {
-            if (abs(gradients[i]) > threshold) {
-                anomalies.push_back(i);
-            }
-        }
-        
-        std::cout << "\n=== DETEKSI ANOMALI TRAFFIC ===" << std::endl;
-        std::cout << "Threshold gradient: " << threshold << " Mbps/jam" << std::endl;
-        
-        for (int anomaly : anomalies) {
-            std::cout << "Anomali pada jam " << time_hours[anomaly] 
-                      << ":00 - Gradient: " << gradients[anomaly] 
-                      << " Mbps/jam" << std::endl;
-        }
-        
-        return anomalies;
+        EventResult result = findAnomalies(threshold);
+        AnalysisReport::printAnomalies(std::cout, result);
+        std::cout.flush();
+        return result.indices();
     }
     
     // METHOD B - PART 7: RUNGE-KUTTA METHODS
     
     // Model dinamika traffic untuk prediksi
     double trafficDynamicsModel(double t, double currentBW) {
-        // Model: dB/dt = -decay*B + seasonal_pattern + noise
-        double decay = 0.03;
-        double amplitude = 1.2;
-        double frequency = 2 * M_PI / 24.0;  // 24-hour cycle
-        double phase = M_PI / 4;             // Peak pada jam 9-10
-        
-        return -decay * currentBW + amplitude * sin(frequency * (t - 6) + phase);
+        // Default: dB/dt = -decay*B + seasonal_pattern (lihat traffic_model.h)
+        DerivativeAt at = {t, currentBW};
+        return models.dispatch(at);
+    }
+    
+    // Parameter model seasonal (dipakai kalibrasi dan ensemble); harmonik
+    // pertama model multi-harmonik ikut diselaraskan
+    void setModelParams(const TrafficModelParams& params) {
+        models.seasonal.params = params;
+        models.multi_harmonic.base = params;
+        models.multi_harmonic.amplitudes[0] = params.amplitude;
+        models.multi_harmonic.phases[0] = params.phase;
     }
+    const TrafficModelParams& getModelParams() const { return models.seasonal.params; }
     
-    // RK4 method untuk prediksi bandwidth masa depan
+    // Pilih model untuk semua prediksi RK4/Dormand-Prince. Kapasitas
+    // model logistik default 1.5 x bandwidth maksimum data.
+    void selectDynamicsModel(TrafficModelKind kind) {
+        models.active = kind;
+        if (kind == TrafficModelKind::LogisticSaturation && getMaxBandwidth() > 0.0) {
+            models.logistic.capacity = 1.5 * getMaxBandwidth();
+        }
+    }
+    TrafficModelRegistry& getModelRegistry() { return models; }
+    
+    // RK4 method untuk prediksi bandwidth masa depan; langkah terakhir
+    // dipendekkan sehingga hasil tepat di targetTime (tidak melewatinya)
     double rk4BandwidthPrediction(double t0, double y0, double h, double targetTime) {
-        double t = t0;
-        double y = y0;
+        OdeOptions options;
+        options.method = OdeMethod::ClassicRk4;
+        options.step = h;
+        options.floor_value = forecast_options.floor_value; // Batas yang sama dengan prediksi lain
+        TrajectoryRun run = {t0, y0, targetTime, &options, nullptr};
+        return models.dispatch(run).endValue();
+    }
+    
+    void setForecastIntegrator(const OdeOptions& options) { forecast_options = options; }
+    const OdeOptions& getForecastIntegrator() const { return forecast_options; }
+    
+    // Satu trajektori dari start_hour dengan dense output; semua titik
+    // prediksi dibaca dari trajektori yang sama
+    DenseTrajectory forecastTrajectory(double start_hour, double end_hour, OdeStats* stats = nullptr) {
+        TrajectoryRun run = {start_hour, bandwidth.back(), end_hour, &forecast_options, stats};
+        return models.dispatch(run);
+    }
+    
+    // Prediksi horizon sembarang: predictions[k] pada start_hour + k * step_hours.
+    // Biaya linear terhadap horizon (satu integrasi + satu merge walk).
+    ForecastResult forecastHorizon(double horizon_hours, double step_hours) {
+        ForecastResult result;
+        if (bandwidth.empty() || !(step_hours > 0.0) || !(horizon_hours >= 0.0)) return result;
+        result.initial_bandwidth = bandwidth.back();
+        result.start_hour = 24.0; // Mulai dari jam 24 (hari berikutnya)
+        result.step_hours = step_hours;
+        
+        size_t count = static_cast<size_t>(std::floor(horizon_hours / step_hours + 1e-9)) + 1;
+        std::vector<double> times(count);
+        for (size_t k = 0; k < count; k++) times[k] = result.start_hour + k * step_hours;
+        OdeStats stats;
+        DenseTrajectory trajectory = forecastTrajectory(result.start_hour, times.back(), &stats);
+        result.model_evaluations = stats.evaluations;
+        result.predictions.resize(count);
+        trajectory.evaluate(times.data(), count, result.predictions.data());
+        return result;
+    }
+    
+    // Ensemble model aktif dengan B0 dan parameter terganggu; pita
+    // p5/p50/p95 per jam dari jam 24 (senyap)
+    EnsembleForecastResult forecastEnsemble(const EnsembleOptions& options) {
+        if (bandwidth.empty()) return EnsembleForecastResult();
+        EnsembleRun run = {24.0, bandwidth.back(), &options};
+        return models.dispatch(run);
+    }
+    
+    bool exportEnsembleForecast(const std::string& filename, const EnsembleOptions& options) {
+        EnsembleForecastResult result = forecastEnsemble(options);
+        if (result.p50.empty()) {
+            std::cerr << "Error: Tidak ada data atau parameter ensemble tidak valid." << std::endl;
+            return false;
+        }
+        std::cout << "Model: " << TrafficModelRegistry::name(models.active) << std::endl;
+        AnalysisReport::printEnsembleForecast(std::cout, result);
         
-        while (t < targetTime) {
-            double k1 = h * trafficDynamicsModel(t, y);
-            double k2 = h * trafficDynamicsModel(t + h/2, y + k1/2);
-            double k3 = h * trafficDynamicsModel(t + h/2, y + k2/2);
-            double k4 = h * trafficDynamicsModel(t + h, y + k3);
-            
-            y += (k1 + 2*k2 + 2*k3 + k4) / 6.0;
-            t += h;
-            
-            // Pastikan bandwidth tetap positif
-            if (y < 0.1) y = 0.1;
+        std::ofstream outFile(filename);
+        outFile << "Hour,P5_Mbps,P50_Mbps,P95_Mbps,Mean_Mbps\n";
+        for (size_t k = 0; k < result.p50.size(); k++) {
+            outFile << std::fixed << std::setprecision(4) << result.start_hour + k * result.step_hours << ","
+                    << std::setprecision(6) << result.p5[k] << "," << result.p50[k] << ","
+                    << result.p95[k] << "," << result.mean[k] << "\n";
         }
-        return y;
+        outFile.close();
+        std::cout << "Pita " << result.p50.size() << " titik diekspor ke " << filename << std::endl;
+        return true;
+    }
+    
+    // Prediksi pattern untuk 24 jam ke depan (senyap)
+    ForecastResult forecastNext24Hours() {
+        return forecastHorizon(23.0, 1.0);
     }
     
-    // Prediksi pattern untuk 24 jam ke depan
     std::vector<double> predictNext24Hours() {
-        std::vector<double> predictions;
-        double lastBandwidth = bandwidth.back();
-        double startTime = 24.0; // Mulai dari jam 24 (hari berikutnya)
-        
-        std::cout << "\n=== PREDIKSI RK4 - 24 JAM KE DEPAN ===" << std::endl;
-        std::cout << "Jam\tPrediksi (Mbps)\tInterpretasi" << std::endl;
-        std::cout << "---\t---------------\t-----------" << std::endl;
-        
-        for (int hour = 0; hour < 24; hour++) {
-            double targetTime = startTime + hour;
-            double predicted = rk4BandwidthPrediction(startTime, lastBandwidth, 0.1, targetTime);
-            predictions.push_back(predicted);
-            
-            // Interpretasi berdasarkan pola
-            std::string interpretation;
-            if (hour >= 0 && hour <= 5) interpretation = "Malam (rendah)";
-            else if (hour >= 6 && hour <= 11) interpretation = "Pagi (meningkat)";
-            else if (hour >= 12 && hour <= 17) interpretation = "Siang (tinggi)";
-            else interpretation = "Sore (menurun)";
-            
-            std::cout << std::fixed << std::setprecision(0) << hour 
-                      << "\t" << std::setprecision(3) << predicted
-                      << "\t\t" << interpretation << std::endl;
-        }
-        
-        return predictions;
+        ForecastResult result = forecastNext24Hours();
+        AnalysisReport::printForecast(std::cout, result);
+        std::cout.flush();
+        return result.predictions;
+    }
+    
+    // Analisis komprehensif menggunakan semua method B (senyap)
+    EnhancedAnalysisResult analyze(double anomaly_threshold = 0.6) {
+        EnhancedAnalysisResult result;
+        result.gradients = computeGradients();
+        result.peaks = findTrafficPeaks();
+        result.anomalies = findAnomalies(anomaly_threshold);
+        result.volatility = calculateVolatility();
+        result.forecast = forecastNext24Hours();
+        result.comparison = compareMethods();
+        return result;
     }
     
-    // Analisis komprehensif menggunakan semua method B
     void runEnhancedAnalysis() {
-        std::cout << "\n" << std::string(60, '=') << std::endl;
-        std::cout << "        ANALISIS ENHANCED DENGAN METHOD B" << std::endl;
-        std::cout << std::string(60, '=') << std::endl;
-        
-        // 1. Analisis derivative
-        calculateGradients();
-        
-        // 2. Deteksi peak dan anomali
-        auto peaks = detectTrafficPeaks();
-        auto anomalies = detectAnomalies(0.6);
-        
-        // 3. Analisis volatility
-        double volatility = calculateVolatility();
-        std::cout << "\n=== ANALISIS VOLATILITY ===" << std::endl;
-        std::cout << "Traffic Volatility Index: " << std::fixed << std::setprecision(3) 
-                  << volatility << std::endl;
-        
-        if (volatility < 0.3) std::cout << "Status: Traffic stabil" << std::endl;
-        else if (volatility < 0.6) std::cout << "Status: Traffic moderat" << std::endl;
-        else std::cout << "Status: Traffic sangat variabel" << std::endl;
-        
-        // 4. Prediksi menggunakan RK4
-        auto predictions = predictNext24Hours();
-        
-        // 5. Perbandingan akurasi
-        compareInterpolationMethods();
+        AnalysisReport::printEnhancedAnalysis(std::cout, analyze(0.6));
     }
     
     // Hitung volatility index
     double calculateVolatility() {
-        if (gradients.empty()) calculateGradients();
+        ensureGradients();
         
         double sumSquaredGradients = 0.0;
         int count = 0;
@@ -207,57 +335,143 @@ public:
             }
         }
         
-        return sqrt(sumSquaredGradients / count);
+        return count > 0 ? sqrt(sumSquaredGradients / count) : 0.0;
     }
     
-    // Perbandingan metode interpolasi vs RK4
-    void compareInterpolationMethods() {
-        std::cout << "\n=== PERBANDINGAN METODE PREDIKSI ===" << std::endl;
-        std::cout << "Waktu\tLagrange\tRK4\t\tSelisih" << std::endl;
-        std::cout << "-----\t--------\t---\t\t-------" << std::endl;
+    // Perbandingan metode interpolasi vs RK4 (senyap)
+    std::vector<MethodComparisonRow> compareMethods() {
+        std::vector<MethodComparisonRow> rows;
+        if (bandwidth.empty()) return rows;
         
         std::vector<double> test_times = {25.5, 27.0, 30.5, 33.0}; // Prediksi masa depan
-        
-        for (double t : test_times) {
+        DenseTrajectory trajectory = forecastTrajectory(24.0, test_times.back());
+        rows.resize(test_times.size());
+        for (size_t i = 0; i < test_times.size(); i++) {
+            double t = test_times[i];
+            rows[i].time = t;
             // Interpolasi Lagrange (extrapolation)
-            double lagrange_pred = lagrangeInterpolation(fmod(t, 24.0));
-            
+            rows[i].lagrange = lagrangeInterpolation(fmod(t, 24.0));
             // RK4 prediction
-            double rk4_pred = rk4BandwidthPrediction(24.0, bandwidth.back(), 0.1, t);
-            
-            double difference = abs(lagrange_pred - rk4_pred);
-            
-            std::cout << std::fixed << std::setprecision(1) << t 
-                      << "\t" << std::setprecision(3) << lagrange_pred
-                      << "\t\t" << rk4_pred 
-                      << "\t\t" << difference << std::endl;
+            rows[i].rk4 = trajectory.evaluate(t);
+            rows[i].difference = std::fabs(rows[i].lagrange - rows[i].rk4);
+        }
+        return rows;
+    }
+    
+    void compareInterpolationMethods() {
+        AnalysisReport::printComparison(std::cout, compareMethods());
+        std::cout.flush();
+    }
+    
+    // Export prediksi horizon panjang (mis. 1 minggu per menit)
+    bool exportForecast(const std::string& filename, double horizon_hours, double step_hours) {
+        ForecastResult result = forecastHorizon(horizon_hours, step_hours);
+        if (result.predictions.empty()) {
+            std::cerr << "Error: Tidak ada data atau parameter horizon tidak valid." << std::endl;
+            return false;
         }
         
-        std::cout << "\nKesimpulan:" << std::endl;
-        std::cout << "- Lagrange: Baik untuk interpolasi dalam rentang data" << std::endl;
-        std::cout << "- RK4: Lebih akurat untuk prediksi jangka panjang" << std::endl;
+        std::ofstream outFile(filename);
+        outFile << "Hour,RK4_Prediction_Mbps\n";
+        for (size_t k = 0; k < result.predictions.size(); k++) {
+            outFile << std::fixed << std::setprecision(4) << result.start_hour + k * result.step_hours << ","
+                    << std::setprecision(6) << result.predictions[k] << "\n";
+        }
+        outFile.close();
+        std::cout << "Integrator: " << OdeIntegrator::methodName(forecast_options.method)
+                  << " (" << result.model_evaluations << " evaluasi model)" << std::endl;
+        std::cout << "Prediksi " << result.predictions.size() << " titik diekspor ke " << filename << std::endl;
+        return true;
+    }
+    
+    // Kalibrator hanya mengenal parameter model seasonal; model lain
+    // ditolak agar hasilnya tidak diam-diam berbeda dari prediksi
+    bool calibrationSupported() const {
+        if (models.active == TrafficModelKind::SeasonalDecay) return true;
+        std::cerr << "Error: Kalibrasi hanya mendukung model "
+                  << TrafficModelRegistry::name(TrafficModelKind::SeasonalDecay) << "; model aktif "
+                  << TrafficModelRegistry::name(models.active) << "." << std::endl;
+        return false;
+    }
+    
+    // Kalibrasi model dinamika ke deret yang dimuat (senyap kecuali model
+    // aktif tidak didukung); parameter model tidak berubah sampai
+    // applyCalibration() dipanggil
+    CalibrationResult calibrateModel(const CalibrationOptions& options = CalibrationOptions()) {
+        CalibrationResult result;
+        if (!calibrationSupported() || !time_hours_sorted || time_hours.size() < 2) return result;
+        result = ModelCalibrator::fit(time_hours.data(), bandwidth.data(), time_hours.size(), models.seasonal.params,
+                                      options);
+        result.label = "Pola 24 jam";
+        return result;
+    }
+    
+    // Satu fit per hari dari profil 7 x 24, paralel antar deret
+    std::vector<CalibrationResult> calibrateWeeklyProfile(const CalibrationOptions& options = CalibrationOptions()) {
+        std::vector<CalibrationSeries> series;
+        const TrafficProfile& profile = getWeeklyProfile();
+        if (!calibrationSupported() || profile.empty() || profile.slotDay(0) < 0) return std::vector<CalibrationResult>();
+        for (int day = 0; day < TrafficProfile::DAYS_PER_WEEK; day++) {
+            CalibrationSeries item;
+            item.label = TrafficProfile::dayName(day);
+            size_t observed = 0;
+            for (int hour = 0; hour < TrafficProfile::HOURS_PER_DAY; hour++) {
+                const ProfileSlot& slot = profile.slot(day * TrafficProfile::HOURS_PER_DAY + hour);
+                observed += slot.count;
+                item.times.push_back(hour);
+                item.values.push_back(slot.mean);
+            }
+            if (observed > 0) series.push_back(item); // Hari tanpa data hanya hasil interpolasi
+        }
+        return ModelCalibrator::fitBatch(series, models.seasonal.params, options);
+    }
+    
+    // Batas bawah prediksi ikut disamakan dengan batas saat fit; batas
+    // 0.1 Mbps lama akan menelan deret ber-skala kbps sepenuhnya
+    void applyCalibration(const CalibrationResult& result, double floor_value = CalibrationOptions().floor_value) {
+        setModelParams(result.params);
+        forecast_options.floor_value = floor_value;
+    }
+    
+    bool exportCalibration(const std::string& filename, const std::vector<CalibrationResult>& results) {
+        std::ofstream outFile(filename);
+        if (!outFile.is_open()) {
+            std::cerr << "Error: Tidak dapat membuat file " << filename << std::endl;
+            return false;
+        }
+        outFile << "Series,Decay,Amplitude,Phase,Baseline_Mbps,Initial_Mbps,RMSE_Before,RMSE_After,Iterations,Converged\n";
+        for (const CalibrationResult& result : results) {
+            outFile << result.label << "," << std::setprecision(6) << result.params.decay << ","
+                    << result.params.amplitude << "," << result.params.phase << "," << result.params.baseline << ","
+                    << result.initial_value << "," << result.initial_rmse << "," << result.rmse << ","
+                    << result.iterations << "," << (result.converged ? 1 : 0) << "\n";
+        }
+        outFile.close();
+        std::cout << "Hasil kalibrasi diekspor ke " << filename << std::endl;
+        return true;
     }
     
-    // Export hasil enhanced analysis
+    // Export hasil enhanced analysis (tanpa mencetak ulang tabel prediksi)
     void exportEnhancedResults(const std::string& filename) {
         std::ofstream outFile(filename);
         
         // Header
-        outFile << "Hour,Bandwidth_Mbps,Gradient_Mbps_per_hour,Second_Derivative,RK4_Prediction_Next_Day" << std::endl;
+        outFile << "Hour,Bandwidth_Mbps,Gradient_Mbps_per_hour,Second_Derivative,RK4_Prediction_Next_Day\n";
         
         // Hitung gradient jika belum
-        if (gradients.empty()) calculateGradients();
+        ensureGradients();
         
         // Prediksi untuk hari berikutnya
-        auto next_day_predictions = predictNext24Hours();
+        std::vector<double> next_day_predictions = forecastNext24Hours().predictions;
         
-        // Export data
+        // Export data (kolom prediksi kosong di luar 24 jam pertama)
         for (size_t i = 0; i < bandwidth.size(); i++) {
             outFile << time_hours[i] << ","
                     << bandwidth[i] << ","
                     << gradients[i] << ","
-                    << second_derivatives[i] << ","
-                    << next_day_predictions[i] << std::endl;
+                    << second_derivatives[i] << ",";
+            if (i < next_day_predictions.size()) outFile << next_day_predictions[i];
+            outFile << "\n";
         }
         
         outFile.close();
@@ -0,0 +1,266 @@
+#include "ensemble_forecaster.h"
+#include "ip_address.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Normal standar deterministik dari (seed, anggota, indeks) lewat
+// splitmix64 + Box-Muller; tidak ada state bersama antar thread
+double gaussian(uint64_t seed, size_t member, unsigned index) {
+    uint64_t base = mixHash64(seed ^ mixHash64(static_cast<uint64_t>(member) * 4 + index));
+    double u1 = (static_cast<double>(base >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+    double u2 = static_cast<double>(mixHash64(base) >> 11) * (1.0 / 9007199254740992.0);
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(2 * M_PI * u2);
+}
+
+double perturbInitial(double initial_bandwidth, const EnsembleOptions& options, size_t member) {
+    return initial_bandwidth * std::exp(options.initial_sigma * gaussian(options.seed, member, 0));
+}
+
+// Gangguan parameter anggota untuk setiap policy model (indeks gaussian
+// 1-3 sama untuk semua model sehingga hasil hanya bergantung pada seed)
+void perturbModel(SeasonalDecayModel& model, const EnsembleOptions& options, size_t member) {
+    TrafficModelParams& params = model.params;
+    params.decay *= std::exp(options.decay_sigma * gaussian(options.seed, member, 1));
+    params.amplitude *= std::exp(options.amplitude_sigma * gaussian(options.seed, member, 2));
+    params.phase += options.phase_sigma * gaussian(options.seed, member, 3);
+}
+
+void perturbModel(MultiHarmonicModel& model, const EnsembleOptions& options, size_t member) {
+    model.base.decay *= std::exp(options.decay_sigma * gaussian(options.seed, member, 1));
+    double scale = std::exp(options.amplitude_sigma * gaussian(options.seed, member, 2));
+    double shift = options.phase_sigma * gaussian(options.seed, member, 3);
+    for (int k = 0; k < model.harmonics; k++) {
+        model.amplitudes[k] *= scale;
+        model.phases[k] += shift;
+    }
+}
+
+void perturbModel(LogisticSaturationModel& model, const EnsembleOptions& options, size_t member) {
+    model.growth *= std::exp(options.amplitude_sigma * gaussian(options.seed, member, 2));
+    model.phase += options.phase_sigma * gaussian(options.seed, member, 3);
+}
+
+// Grid waktu bersama semua anggota
+struct EnsembleGrid {
+    double start_hour;
+    double h;          // Langkah RK4 (pas di setiap output)
+    size_t steps;
+    size_t substeps;   // Langkah per output
+    size_t members;
+};
+
+// Kernel lane generik: satu salinan model terganggu per lane, ruas kanan
+// dipanggil langsung (diinline untuk tipe konkret). values[k * members + m]
+// diisi untuk anggota first..first+count-1.
+template <typename Model>
+class LaneKernel {
+private:
+    const Model& model;
+    double initial_bandwidth;
+    const EnsembleOptions& options;
+    EnsembleGrid grid;
+
+public:
+    LaneKernel(const Model& base, double initial, const EnsembleOptions& ensemble_options, const EnsembleGrid& ensemble_grid)
+        : model(base), initial_bandwidth(initial), options(ensemble_options), grid(ensemble_grid) {}
+
+    void runBlock(size_t first, size_t count, double* values) const {
+        const size_t LANES = EnsembleForecaster::LANES;
+        Model lanes[LANES];
+        double y[LANES];
+        for (size_t lane = 0; lane < LANES; lane++) {
+            // Lane kosong di blok terakhir mengulang anggota pertama blok
+            size_t member = first + (lane < count ? lane : 0);
+            lanes[lane] = model;
+            perturbModel(lanes[lane], options, member);
+            y[lane] = perturbInitial(initial_bandwidth, options, member);
+        }
+        for (size_t lane = 0; lane < count; lane++) values[first + lane] = y[lane];
+
+        const double h = grid.h, floor_value = options.floor_value;
+        for (size_t step = 0; step < grid.steps; step++) {
+            double t = grid.start_hour + h * static_cast<double>(step);
+            for (size_t lane = 0; lane < LANES; lane++) {
+                const Model& f = lanes[lane];
+                double k1 = f(t, y[lane]);
+                double k2 = f(t + 0.5 * h, y[lane] + 0.5 * h * k1);
+                double k3 = f(t + 0.5 * h, y[lane] + 0.5 * h * k2);
+                double k4 = f(t + h, y[lane] + h * k3);
+                double next = y[lane] + h / 6.0 * (k1 + 2 * k2 + 2 * k3 + k4);
+                y[lane] = next < floor_value ? floor_value : next;
+            }
+            if ((step + 1) % grid.substeps == 0) {
+                double* row = &values[(step + 1) / grid.substeps * grid.members + first];
+                for (size_t lane = 0; lane < count; lane++) row[lane] = y[lane];
+            }
+        }
+    }
+};
+
+// Spesialisasi seasonal: ruas kanan -d*y + (l + a*sin + b*cos) dengan
+// sin/cos dari tabel bersama, tanpa fungsi transenden per lane
+template <>
+class LaneKernel<SeasonalDecayModel> {
+private:
+    const SeasonalDecayModel& model;
+    double initial_bandwidth;
+    const EnsembleOptions& options;
+    EnsembleGrid grid;
+    std::vector<double> sines, cosines; // sin/cos(w * (t - offset)) per setengah langkah
+
+public:
+    LaneKernel(const SeasonalDecayModel& base, double initial, const EnsembleOptions& ensemble_options,
+               const EnsembleGrid& ensemble_grid)
+        : model(base), initial_bandwidth(initial), options(ensemble_options), grid(ensemble_grid),
+          sines(2 * ensemble_grid.steps + 1), cosines(2 * ensemble_grid.steps + 1) {
+        double frequency = model.params.frequency();
+        for (size_t j = 0; j <= 2 * grid.steps; j++) {
+            double angle = frequency * (grid.start_hour + 0.5 * grid.h * static_cast<double>(j) - model.params.time_offset);
+            sines[j] = std::sin(angle);
+            cosines[j] = std::cos(angle);
+        }
+    }
+
+    void runBlock(size_t first, size_t count, double* values) const {
+        const size_t LANES = EnsembleForecaster::LANES;
+        double y[LANES], decay[LANES], level[LANES], sine_weight[LANES], cosine_weight[LANES];
+        for (size_t lane = 0; lane < LANES; lane++) {
+            // Lane kosong di blok terakhir mengulang anggota pertama blok
+            size_t member = first + (lane < count ? lane : 0);
+            SeasonalDecayModel perturbed = model;
+            perturbModel(perturbed, options, member);
+            const TrafficModelParams& params = perturbed.params;
+            y[lane] = perturbInitial(initial_bandwidth, options, member);
+            decay[lane] = params.decay;
+            level[lane] = params.decay * params.baseline;
+            sine_weight[lane] = params.amplitude * std::cos(params.phase);
+            cosine_weight[lane] = params.amplitude * std::sin(params.phase);
+        }
+        for (size_t lane = 0; lane < count; lane++) values[first + lane] = y[lane];
+
+        const double h = grid.h, floor_value = options.floor_value;
+        for (size_t step = 0; step < grid.steps; step++) {
+            double s0 = sines[2 * step], c0 = cosines[2 * step];
+            double s1 = sines[2 * step + 1], c1 = cosines[2 * step + 1];
+            double s2 = sines[2 * step + 2], c2 = cosines[2 * step + 2];
+            for (size_t lane = 0; lane < LANES; lane++) {
+                double d = decay[lane], l = level[lane], a = sine_weight[lane], b = cosine_weight[lane];
+                double forcing_mid = l + a * s1 + b * c1;
+                double k1 = -d * y[lane] + (l + a * s0 + b * c0);
+                double k2 = -d * (y[lane] + 0.5 * h * k1) + forcing_mid;
+                double k3 = -d * (y[lane] + 0.5 * h * k2) + forcing_mid;
+                double k4 = -d * (y[lane] + h * k3) + (l + a * s2 + b * c2);
+                double next = y[lane] + h / 6.0 * (k1 + 2 * k2 + 2 * k3 + k4);
+                y[lane] = next < floor_value ? floor_value : next;
+            }
+            if ((step + 1) % grid.substeps == 0) {
+                double* row = &values[(step + 1) / grid.substeps * grid.members + first];
+                for (size_t lane = 0; lane < count; lane++) row[lane] = y[lane];
+            }
+        }
+    }
+};
+
+// Persentil dengan interpolasi linear antar statistik terurut
+double percentile(std::vector<double>& values, double q) {
+    double position = q * static_cast<double>(values.size() - 1);
+    size_t lower = static_cast<size_t>(position);
+    std::nth_element(values.begin(), values.begin() + lower, values.end());
+    double low = values[lower];
+    if (lower + 1 >= values.size()) return low;
+    double high = *std::min_element(values.begin() + lower + 1, values.end());
+    return low + (high - low) * (position - static_cast<double>(lower));
+}
+
+template <typename Work>
+void parallelFor(size_t count, unsigned threads, const Work& work) {
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads; i++) {
+        workers.push_back(std::thread([&next, count, &work]() {
+            for (size_t item = next++; item < count; item = next++) work(item);
+        }));
+    }
+    for (auto& worker : workers) worker.join();
+}
+
+// Kerangka bersama semua model: validasi, grid output, pembagian blok ke
+// thread dan persentil per jam
+template <typename Model>
+EnsembleForecastResult runEnsemble(const Model& model, double start_hour, double initial_bandwidth,
+                                   const EnsembleOptions& options) {
+    EnsembleForecastResult result;
+    if (options.members == 0 || !(options.output_step_hours > 0.0) || !(options.step_hours > 0.0) ||
+        !(options.horizon_hours >= 0.0)) {
+        return result;
+    }
+    std::chrono::steady_clock::time_point start_clock = std::chrono::steady_clock::now();
+
+    result.start_hour = start_hour;
+    result.step_hours = options.output_step_hours;
+    result.members = options.members;
+    size_t outputs = static_cast<size_t>(std::floor(options.horizon_hours / options.output_step_hours + 1e-9)) + 1;
+    // Langkah dibulatkan sehingga setiap output tepat di titik grid RK4
+    EnsembleGrid grid;
+    grid.start_hour = start_hour;
+    grid.substeps = static_cast<size_t>(std::ceil(options.output_step_hours / options.step_hours - 1e-9));
+    grid.h = options.output_step_hours / static_cast<double>(grid.substeps);
+    grid.steps = (outputs - 1) * grid.substeps;
+    grid.members = options.members;
+    LaneKernel<Model> kernel(model, initial_bandwidth, options, grid);
+
+    unsigned threads = options.threads;
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+
+    // values[k * members + m]: anggota m pada output k (satu jam = satu baris kontigu)
+    size_t members = options.members;
+    std::vector<double> values(outputs * members);
+    const size_t LANES = EnsembleForecaster::LANES;
+    size_t blocks = (members + LANES - 1) / LANES;
+    parallelFor(blocks, threads, [&](size_t block) {
+        size_t first = block * LANES;
+        kernel.runBlock(first, std::min(LANES, members - first), values.data());
+    });
+
+    result.p5.resize(outputs);
+    result.p50.resize(outputs);
+    result.p95.resize(outputs);
+    result.mean.resize(outputs);
+    parallelFor(outputs, threads, [&](size_t k) {
+        std::vector<double> row(values.begin() + k * members, values.begin() + (k + 1) * members);
+        double sum = 0.0;
+        for (double value : row) sum += value;
+        result.mean[k] = sum / static_cast<double>(members);
+        result.p5[k] = percentile(row, 0.05);
+        result.p50[k] = percentile(row, 0.50);
+        result.p95[k] = percentile(row, 0.95);
+    });
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_clock).count();
+    return result;
+}
+
+} // namespace
+
+EnsembleForecastResult EnsembleForecaster::run(const SeasonalDecayModel& model, double start_hour,
+                                               double initial_bandwidth, const EnsembleOptions& options) {
+    return runEnsemble(model, start_hour, initial_bandwidth, options);
+}
+
+EnsembleForecastResult EnsembleForecaster::run(const MultiHarmonicModel& model, double start_hour,
+                                               double initial_bandwidth, const EnsembleOptions& options) {
+    return runEnsemble(model, start_hour, initial_bandwidth, options);
+}
+
+EnsembleForecastResult EnsembleForecaster::run(const LogisticSaturationModel& model, double start_hour,
+                                               double initial_bandwidth, const EnsembleOptions& options) {
+    return runEnsemble(model, start_hour, initial_bandwidth, options);
+}
+
@@ -0,0 +1,56 @@
+#ifndef ENSEMBLE_FORECASTER_H
+#define ENSEMBLE_FORECASTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include "traffic_model.h"
+#include "analysis_results.h"
+
+struct EnsembleOptions {
+    size_t members;
+    double horizon_hours;
+    double output_step_hours;  // Jarak antar titik pita
+    double step_hours;         // Langkah RK4 maksimum (dibulatkan agar pas di setiap output)
+    // Gangguan per anggota: B0, decay, amplitude log-normal (sigma relatif),
+    // phase normal (radian)
+    double initial_sigma;
+    double decay_sigma;
+    double amplitude_sigma;
+    double phase_sigma;
+    double floor_value;
+    uint64_t seed;             // Hasil hanya bergantung pada seed, bukan jumlah thread
+    unsigned threads;          // 0 = semua core
+
+    EnsembleOptions()
+        : members(10000), horizon_hours(168.0), output_step_hours(1.0), step_hours(0.1),
+          initial_sigma(0.1), decay_sigma(0.2), amplitude_sigma(0.2), phase_sigma(0.2),
+          floor_value(0.1), seed(0x5eed2024ULL), threads(0) {}
+};
+
+// Ensemble RK4 untuk model traffic dengan parameter terganggu. Anggota
+// diproses per LANES dalam layout SoA dengan kernel lane yang ditemplate
+// pada policy model (traffic_model.h), sehingga hasilnya sama dengan model
+// yang dipakai prediksi tunggal. Kernel generik memanggil model langsung
+// di setiap tahap; spesialisasi seasonal memanfaatkan frekuensi yang sama
+// untuk semua anggota: sin(w*(t - offset) + phase) dipecah menjadi
+// a*cos(phase)*sin(w*(t - offset)) + a*sin(phase)*cos(w*(t - offset)),
+// dan tabel sin/cos per setengah langkah dihitung sekali dan dipakai
+// bersama. Blok dibagi ke semua core, lalu persentil dihitung per jam
+// dengan nth_element, juga paralel.
+//
+// Gangguan per model: seasonal = decay, amplitude, phase; multi-harmonik =
+// decay, semua amplitudo diskala dan semua fase digeser bersama; logistik =
+// growth (amplitude_sigma) dan phase, decay_sigma tidak dipakai.
+class EnsembleForecaster {
+public:
+    static const size_t LANES = 8;
+
+    static EnsembleForecastResult run(const SeasonalDecayModel& model, double start_hour, double initial_bandwidth,
+                                      const EnsembleOptions& options);
+    static EnsembleForecastResult run(const MultiHarmonicModel& model, double start_hour, double initial_bandwidth,
+                                      const EnsembleOptions& options);
+    static EnsembleForecastResult run(const LogisticSaturationModel& model, double start_hour,
+                                      double initial_bandwidth, const EnsembleOptions& options);
+};
+
+#endif // ENSEMBLE_FORECASTER_H
@@ -0,0 +1,178 @@
+#include "flow_aggregator.h"
+#include <algorithm>
+#include <cstring>
+
+static const size_t INITIAL_CAPACITY = 1024;
+
+FlowAggregator::FlowAggregator() : used(0) {
+    Slot empty_slot;
+    std::memset(&empty_slot, 0, sizeof(empty_slot));
+    slots.assign(INITIAL_CAPACITY, empty_slot);
+}
+
+uint64_t FlowAggregator::hashKey(const FlowKey& key, int64_t interval_id) {
+    // Kombinasi perkalian murah per field, lalu satu finalizer penuh
+    uint64_t h = key.src.lo * 0x9e3779b97f4a7c15ULL;
+    h ^= key.src.hi * 0xc2b2ae3d27d4eb4fULL;
+    h ^= key.dst.lo * 0x165667b19e3779f9ULL + (h >> 29);
+    h ^= key.dst.hi * 0x85ebca77c2b2ae63ULL;
+    h ^= (static_cast<uint64_t>(key.protocol) << 48) ^ static_cast<uint64_t>(interval_id) * 0x27d4eb2f165667c5ULL;
+    return mixHash64(h);
+}
+
+FlowKey FlowAggregator::slotKey(const Slot& slot) {
+    FlowKey key;
+    key.src = slot.src;
+    key.dst = slot.dst;
+    key.protocol = slot.protocol;
+    return key;
+}
+
+uint32_t FlowAggregator::internProtocol(const char* begin, const char* end) {
+    size_t length = static_cast<size_t>(end - begin);
+    // Jumlah protokol berbeda kecil (puluhan), pencarian linear cukup cepat
+    for (size_t i = 0; i < protocols.size(); i++) {
+        if (protocols[i].size() == length && std::memcmp(protocols[i].data(), begin, length) == 0) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+    protocols.push_back(std::string(begin, end));
+    return static_cast<uint32_t>(protocols.size() - 1);
+}
+
+void FlowAggregator::addHashed(const FlowKey& key, int64_t interval_id, uint64_t hash,
+                               int64_t bytes, int64_t packets) {
+    uint32_t tag = static_cast<uint32_t>(hash >> 32) | 1u;
+    size_t mask = slots.size() - 1;
+    size_t index = static_cast<size_t>(hash) & mask;
+
+    while (true) {
+        Slot& slot = slots[index];
+        if (slot.tag == 0) {
+            // Slot baru; jaga load factor <= 0.7
+            if ((used + 1) * 10 > slots.size() * 7) {
+                rehash(slots.size() * 2);
+                addHashed(key, interval_id, hash, bytes, packets);
+                return;
+            }
+            slot.src = key.src;
+            slot.dst = key.dst;
+            slot.protocol = key.protocol;
+            slot.interval_id = interval_id;
+            slot.bytes = bytes;
+            slot.packets = packets;
+            slot.tag = tag;
+            used++;
+            return;
+        }
+        if (slot.tag == tag && slot.interval_id == interval_id && slot.protocol == key.protocol &&
+            slot.src == key.src && slot.dst == key.dst) {
+            slot.bytes += bytes;
+            slot.packets += packets;
+            return;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+void FlowAggregator::rehash(size_t new_capacity) {
+    std::vector<Slot> old_slots;
+    old_slots.swap(slots);
+
+    Slot empty_slot;
+    std::memset(&empty_slot, 0, sizeof(empty_slot));
+    slots.assign(new_capacity, empty_slot);
+    used = 0;
+
+    for (const Slot& slot : old_slots) {
+        if (slot.tag == 0) continue;
+        FlowKey key = slotKey(slot);
+        addHashed(key, slot.interval_id, hashKey(key, slot.interval_id), slot.bytes, slot.packets);
+    }
+}
+
+void FlowAggregator::merge(const FlowAggregator& other) {
+    // Id protokol partial lain dipetakan ke id milik objek ini
+    std::vector<uint32_t> remap(other.protocols.size());
+    for (size_t i = 0; i < other.protocols.size(); i++) {
+        const std::string& name = other.protocols[i];
+        remap[i] = internProtocol(name.data(), name.data() + name.size());
+    }
+
+    for (const Slot& slot : other.slots) {
+        if (slot.tag == 0) continue;
+        FlowKey key = slotKey(slot);
+        key.protocol = remap[slot.protocol];
+        addHashed(key, slot.interval_id, hashKey(key, slot.interval_id), slot.bytes, slot.packets);
+    }
+}
+
+std::vector<FlowIntervalRecord> FlowAggregator::records() const {
+    std::vector<FlowIntervalRecord> result;
+    result.reserve(used);
+    for (const Slot& slot : slots) {
+        if (slot.tag == 0) continue;
+        FlowIntervalRecord record;
+        record.key = slotKey(slot);
+        record.interval_id = slot.interval_id;
+        record.bytes = slot.bytes;
+        record.packets = slot.packets;
+        result.push_back(record);
+    }
+    std::sort(result.begin(), result.end(), [](const FlowIntervalRecord& a, const FlowIntervalRecord& b) {
+        if (a.interval_id != b.interval_id) return a.interval_id < b.interval_id;
+        return a.bytes > b.bytes;
+    });
+    return result;
+}
+
+std::vector<FlowTotal> FlowAggregator::flowTotals(size_t limit) const {
+    // Gabungkan semua interval milik flow yang sama dengan tabel sementara
+    FlowAggregator totals;
+    totals.protocols = protocols;
+    for (const Slot& slot : slots) {
+        if (slot.tag == 0) continue;
+        FlowKey key = slotKey(slot);
+        totals.addHashed(key, 0, hashKey(key, 0), slot.bytes, slot.packets);
+    }
+
+    std::vector<FlowTotal> result;
+    result.reserve(totals.used);
+    for (const Slot& slot : totals.slots) {
+        if (slot.tag == 0) continue;
+        FlowTotal total = {slotKey(slot), slot.bytes, slot.packets};
+        result.push_back(total);
+    }
+    std::sort(result.begin(), result.end(), [](const FlowTotal& a, const FlowTotal& b) {
+        return a.bytes > b.bytes;
+    });
+    if (limit > 0 && result.size() > limit) result.resize(limit);
+    return result;
+}
+
+std::vector<HostTotal> FlowAggregator::hostTotals(bool by_source, size_t limit) const {
+    // Host dipetakan ke kunci flow (host, 0, 0) agar tabel yang sama bisa dipakai
+    FlowAggregator totals;
+    IpAddress none = {0, 0};
+    for (const Slot& slot : slots) {
+        if (slot.tag == 0) continue;
+        FlowKey key;
+        key.src = by_source ? slot.src : slot.dst;
+        key.dst = none;
+        key.protocol = 0;
+        totals.addHashed(key, 0, hashKey(key, 0), slot.bytes, slot.packets);
+    }
+
+    std::vector<HostTotal> result;
+    result.reserve(totals.used);
+    for (const Slot& slot : totals.slots) {
+        if (slot.tag == 0) continue;
+        HostTotal total = {slot.src, slot.bytes, slot.packets};
+        result.push_back(total);
+    }
+    std::sort(result.begin(), result.end(), [](const HostTotal& a, const HostTotal& b) {
+        return a.bytes > b.bytes;
+    });
+    if (limit > 0 && result.size() > limit) result.resize(limit);
+    return result;
+}
@@ -0,0 +1,92 @@
+#ifndef FLOW_AGGREGATOR_H
+#define FLOW_AGGREGATOR_H
+
+#include "ip_address.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Kunci flow 3-tuple: source IP, destination IP, protokol (id hasil intern)
+struct FlowKey {
+    IpAddress src;
+    IpAddress dst;
+    uint32_t protocol;
+
+    bool operator==(const FlowKey& other) const {
+        return src == other.src && dst == other.dst && protocol == other.protocol;
+    }
+};
+
+// Byte dan paket satu flow dalam satu interval
+struct FlowIntervalRecord {
+    FlowKey key;
+    int64_t interval_id;
+    int64_t bytes;
+    int64_t packets;
+};
+
+// Total per flow atau per host di seluruh capture
+struct FlowTotal {
+    FlowKey key;
+    int64_t bytes;
+    int64_t packets;
+};
+
+struct HostTotal {
+    IpAddress host;
+    int64_t bytes;
+    int64_t packets;
+};
+
+// Agregasi per-flow per-interval dengan hash table open-addressing
+// (linear probing, kapasitas pangkat dua). Slot disimpan kontigu sehingga
+// satu paket biasanya hanya menyentuh satu cache line. Nama protokol
+// di-intern menjadi id kecil; merge() memetakan ulang id antar partial.
+class FlowAggregator {
+private:
+    // Satu slot = 64 byte (satu cache line pada kebanyakan CPU)
+    struct Slot {
+        IpAddress src;
+        IpAddress dst;
+        int64_t interval_id;
+        int64_t bytes;
+        int64_t packets;
+        uint32_t protocol;
+        uint32_t tag; // Bit atas hash, 0 = slot kosong
+    };
+
+    std::vector<Slot> slots;
+    size_t used;
+    std::vector<std::string> protocols;
+
+    static uint64_t hashKey(const FlowKey& key, int64_t interval_id);
+    void rehash(size_t new_capacity);
+    void addHashed(const FlowKey& key, int64_t interval_id, uint64_t hash, int64_t bytes, int64_t packets);
+    static FlowKey slotKey(const Slot& slot);
+
+public:
+    FlowAggregator();
+
+    // Id protokol untuk teks [begin, end); protokol baru ditambahkan
+    uint32_t internProtocol(const char* begin, const char* end);
+    const std::string& protocolName(uint32_t id) const { return protocols[id]; }
+
+    void add(const FlowKey& key, int64_t interval_id, int64_t bytes) {
+        addHashed(key, interval_id, hashKey(key, interval_id), bytes, 1);
+    }
+
+    void merge(const FlowAggregator& other);
+
+    size_t size() const { return used; }
+    bool empty() const { return used == 0; }
+
+    // Semua record (flow, interval), diurutkan interval lalu byte menurun
+    std::vector<FlowIntervalRecord> records() const;
+    // Total per flow, diurutkan byte menurun; limit 0 = semua
+    std::vector<FlowTotal> flowTotals(size_t limit = 0) const;
+    // Total per host (source atau destination), diurutkan byte menurun
+    std::vector<HostTotal> hostTotals(bool by_source, size_t limit = 0) const;
+};
+
+#endif // FLOW_AGGREGATOR_H
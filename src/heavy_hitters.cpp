@@ -0,0 +1,233 @@
+#include "heavy_hitters.h"
+#include <algorithm>
+#include <cmath>
+
+SpaceSavingSketch::SpaceSavingSketch(size_t counter_capacity)
+    : capacity(counter_capacity), total_bytes(0) {}
+
+size_t SpaceSavingSketch::capacityForError(double epsilon) {
+    if (epsilon <= 0.0) return 0;
+    return static_cast<size_t>(std::ceil(1.0 / epsilon));
+}
+
+size_t SpaceSavingSketch::findSlot(const IpAddress& host) const {
+    size_t mask = index.size() - 1;
+    size_t slot = static_cast<size_t>(hashIp(host)) & mask;
+    while (index[slot] >= 0 && heap[index[slot]].host != host) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void SpaceSavingSketch::indexSet(const IpAddress& host, size_t position) {
+    index[findSlot(host)] = static_cast<int32_t>(position);
+}
+
+void SpaceSavingSketch::indexErase(const IpAddress& host) {
+    // Penghapusan backward-shift agar rantai linear probing tetap utuh
+    size_t mask = index.size() - 1;
+    size_t hole = findSlot(host);
+    index[hole] = -1;
+    size_t next = hole;
+    while (true) {
+        next = (next + 1) & mask;
+        if (index[next] < 0) break;
+        size_t home = static_cast<size_t>(hashIp(heap[index[next]].host)) & mask;
+        bool movable = (hole <= next) ? (home <= hole || home > next) : (home <= hole && home > next);
+        if (movable) {
+            index[hole] = index[next];
+            index[next] = -1;
+            hole = next;
+        }
+    }
+}
+
+void SpaceSavingSketch::swapCounters(size_t a, size_t b) {
+    // Slot indeks dicari sebelum swap: findSlot membandingkan host di heap
+    size_t slot_a = findSlot(heap[a].host);
+    size_t slot_b = findSlot(heap[b].host);
+    std::swap(heap[a], heap[b]);
+    index[slot_a] = static_cast<int32_t>(b);
+    index[slot_b] = static_cast<int32_t>(a);
+}
+
+void SpaceSavingSketch::siftDown(size_t position) {
+    size_t n = heap.size();
+    while (true) {
+        size_t left = 2 * position + 1;
+        size_t right = left + 1;
+        size_t smallest = position;
+        if (left < n && heap[left].bytes < heap[smallest].bytes) smallest = left;
+        if (right < n && heap[right].bytes < heap[smallest].bytes) smallest = right;
+        if (smallest == position) return;
+        swapCounters(position, smallest);
+        position = smallest;
+    }
+}
+
+void SpaceSavingSketch::rebuildIndex() {
+    size_t slots = 1;
+    while (slots < capacity * 2) slots <<= 1;
+    index.assign(slots, -1);
+    for (size_t i = 0; i < heap.size(); i++) {
+        indexSet(heap[i].host, i);
+    }
+}
+
+void SpaceSavingSketch::add(const IpAddress& host, int64_t bytes) {
+    if (capacity == 0) return;
+    if (index.empty()) rebuildIndex(); // Alokasi tertunda: interval kosong tetap murah
+    total_bytes += bytes;
+
+    size_t slot = findSlot(host);
+    if (index[slot] >= 0) {
+        size_t position = static_cast<size_t>(index[slot]);
+        heap[position].bytes += bytes;
+        siftDown(position);
+        return;
+    }
+
+    if (heap.size() < capacity) {
+        // Masih ada counter kosong: sisipkan lalu naikkan (sift-up)
+        Counter counter = {host, bytes, 0};
+        heap.push_back(counter);
+        size_t position = heap.size() - 1;
+        index[slot] = static_cast<int32_t>(position);
+        while (position > 0) {
+            size_t parent = (position - 1) / 2;
+            if (heap[parent].bytes <= heap[position].bytes) break;
+            swapCounters(parent, position);
+            position = parent;
+        }
+        return;
+    }
+
+    // Sketch penuh: ganti counter terkecil, warisi nilainya sebagai galat
+    int64_t min_bytes = heap[0].bytes;
+    indexErase(heap[0].host);
+    heap[0].host = host;
+    heap[0].error = min_bytes;
+    heap[0].bytes = min_bytes + bytes;
+    indexSet(host, 0);
+    siftDown(0);
+}
+
+int64_t SpaceSavingSketch::errorBound() const {
+    // Counter minimum membatasi galat setiap estimasi (0 jika belum penuh)
+    if (heap.size() < capacity || heap.empty()) return 0;
+    return heap[0].bytes;
+}
+
+void SpaceSavingSketch::merge(const SpaceSavingSketch& other) {
+    if (other.empty()) return;
+    if (capacity == 0) capacity = other.capacity;
+
+    // Host yang tidak tercatat di satu sketch bisa saja memiliki byte
+    // sampai counter minimum sketch tersebut: tambahkan sebagai galat
+    int64_t this_min = errorBound();
+    int64_t other_min = other.errorBound();
+
+    std::vector<Counter> combined;
+    combined.reserve(heap.size() + other.heap.size());
+    for (const Counter& counter : heap) {
+        Counter merged = counter;
+        size_t slot = other.index.empty() ? 0 : other.findSlot(counter.host);
+        if (!other.index.empty() && other.index[slot] >= 0) {
+            const Counter& match = other.heap[other.index[slot]];
+            merged.bytes += match.bytes;
+            merged.error += match.error;
+        } else {
+            merged.bytes += other_min;
+            merged.error += other_min;
+        }
+        combined.push_back(merged);
+    }
+    for (const Counter& counter : other.heap) {
+        if (!index.empty() && index[findSlot(counter.host)] >= 0) continue;
+        Counter merged = counter;
+        merged.bytes += this_min;
+        merged.error += this_min;
+        combined.push_back(merged);
+    }
+
+    // Simpan 'capacity' counter terbesar
+    if (combined.size() > capacity) {
+        std::nth_element(combined.begin(), combined.begin() + capacity, combined.end(),
+                         [](const Counter& a, const Counter& b) { return a.bytes > b.bytes; });
+        combined.resize(capacity);
+    }
+    std::make_heap(combined.begin(), combined.end(),
+                   [](const Counter& a, const Counter& b) { return a.bytes > b.bytes; });
+
+    heap.swap(combined);
+    total_bytes += other.total_bytes;
+    rebuildIndex();
+}
+
+std::vector<HeavyHitter> SpaceSavingSketch::top(size_t n) const {
+    std::vector<HeavyHitter> result;
+    result.reserve(heap.size());
+    for (const Counter& counter : heap) {
+        HeavyHitter hitter = {counter.host, counter.bytes, counter.error};
+        result.push_back(hitter);
+    }
+    std::sort(result.begin(), result.end(), [](const HeavyHitter& a, const HeavyHitter& b) {
+        return a.bytes > b.bytes;
+    });
+    if (result.size() > n) result.resize(n);
+    return result;
+}
+
+const int64_t HeavyHitterTracker::MAX_SPAN_INTERVALS;
+
+HeavyHitterTracker::HeavyHitterTracker(size_t counter_capacity, int64_t max_span_intervals)
+    : capacity(counter_capacity), base_id(0), max_span(max_span_intervals) {}
+
+bool HeavyHitterTracker::slotFor(int64_t interval_id, size_t& slot) {
+    if (sources.empty()) {
+        base_id = interval_id;
+        sources.assign(1, SpaceSavingSketch(capacity));
+        destinations.assign(1, SpaceSavingSketch(capacity));
+        slot = 0;
+        return true;
+    }
+    // Batas rentang seperti TrafficAggregate (selisih unsigned: id bisa jauh)
+    int64_t last_id = base_id + static_cast<int64_t>(sources.size()) - 1;
+    uint64_t span = static_cast<uint64_t>(std::max(last_id, interval_id)) -
+                    static_cast<uint64_t>(std::min(base_id, interval_id));
+    if (span >= static_cast<uint64_t>(max_span)) return false;
+    if (interval_id < base_id) {
+        // Paket sebelum interval pertama (capture tidak terurut)
+        size_t shift = static_cast<size_t>(base_id - interval_id);
+        sources.insert(sources.begin(), shift, SpaceSavingSketch(capacity));
+        destinations.insert(destinations.begin(), shift, SpaceSavingSketch(capacity));
+        base_id = interval_id;
+        slot = 0;
+        return true;
+    }
+    slot = static_cast<size_t>(interval_id - base_id);
+    if (slot >= sources.size()) {
+        sources.resize(slot + 1, SpaceSavingSketch(capacity));
+        destinations.resize(slot + 1, SpaceSavingSketch(capacity));
+    }
+    return true;
+}
+
+void HeavyHitterTracker::merge(const HeavyHitterTracker& other) {
+    for (size_t i = 0; i < other.sources.size(); i++) {
+        if (other.sources[i].empty()) continue;
+        size_t slot;
+        if (!slotFor(other.intervalId(i), slot)) continue; // Di luar rentang (outlier di agregat link)
+        sources[slot].merge(other.sources[i]);
+        destinations[slot].merge(other.destinations[i]);
+    }
+}
+
+SpaceSavingSketch HeavyHitterTracker::combined(bool by_source) const {
+    SpaceSavingSketch result(capacity);
+    const std::vector<SpaceSavingSketch>& sketches = by_source ? sources : destinations;
+    for (const SpaceSavingSketch& sketch : sketches) {
+        result.merge(sketch);
+    }
+    return result;
+}
@@ -0,0 +1,103 @@
+#ifndef HEAVY_HITTERS_H
+#define HEAVY_HITTERS_H
+
+#include "ip_address.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Satu heavy hitter hasil estimasi: byte sebenarnya berada di
+// [bytes - error, bytes]
+struct HeavyHitter {
+    IpAddress host;
+    int64_t bytes;
+    int64_t error;
+};
+
+// Sketch Space-Saving (Metwally dkk.) berbobot dengan memori tetap:
+// paling banyak 'capacity' counter, tidak peduli berapa banyak alamat
+// berbeda yang muncul. Setiap host dengan byte > total/capacity dijamin
+// ada di sketch, dan estimasinya berlebih paling banyak total/capacity.
+// Counter disusun sebagai min-heap terindeks ditambah indeks hash
+// open-addressing sehingga update O(log k).
+class SpaceSavingSketch {
+private:
+    struct Counter {
+        IpAddress host;
+        int64_t bytes;
+        int64_t error;
+    };
+
+    size_t capacity;
+    std::vector<Counter> heap;  // Min-heap berdasarkan bytes
+    std::vector<int32_t> index; // Slot hash -> posisi heap (-1 = kosong)
+    int64_t total_bytes;
+
+    size_t findSlot(const IpAddress& host) const;
+    void indexSet(const IpAddress& host, size_t position); // Sisipkan/perbarui posisi heap
+    void indexErase(const IpAddress& host);
+    void swapCounters(size_t a, size_t b);
+    void siftDown(size_t position);
+    void rebuildIndex();
+
+public:
+    explicit SpaceSavingSketch(size_t counter_capacity = 0);
+
+    // Kapasitas yang menjamin galat <= epsilon * total byte
+    static size_t capacityForError(double epsilon);
+
+    void add(const IpAddress& host, int64_t bytes);
+    void merge(const SpaceSavingSketch& other);
+
+    size_t getCapacity() const { return capacity; }
+    size_t size() const { return heap.size(); }
+    bool empty() const { return heap.empty(); }
+    int64_t getTotalBytes() const { return total_bytes; }
+    // Batas galat maksimum estimasi saat ini
+    int64_t errorBound() const;
+
+    // N host teratas berdasarkan estimasi byte (menurun)
+    std::vector<HeavyHitter> top(size_t n) const;
+};
+
+// Pasangan sketch (source, destination) untuk setiap interval agregasi.
+// Sketch interval dibuat saat paket pertamanya datang; interval
+// diindeks langsung seperti TrafficAggregate.
+class HeavyHitterTracker {
+private:
+    size_t capacity;
+    int64_t base_id;
+    int64_t max_span; // Jumlah interval maksimum [pertama, terakhir]
+    std::vector<SpaceSavingSketch> sources;
+    std::vector<SpaceSavingSketch> destinations;
+
+    // false jika interval memperlebar rentang melewati max_span
+    bool slotFor(int64_t interval_id, size_t& slot);
+
+public:
+    static const int64_t MAX_SPAN_INTERVALS = int64_t(1) << 23; // Sama dengan TrafficAggregate
+
+    explicit HeavyHitterTracker(size_t counter_capacity = 0, int64_t max_span_intervals = MAX_SPAN_INTERVALS);
+
+    bool enabled() const { return capacity > 0; }
+    size_t getCapacity() const { return capacity; }
+
+    void add(int64_t interval_id, const IpAddress& src, const IpAddress& dst, int64_t bytes) {
+        size_t slot;
+        if (!slotFor(interval_id, slot)) return;
+        sources[slot].add(src, bytes);
+        destinations[slot].add(dst, bytes);
+    }
+
+    void merge(const HeavyHitterTracker& other);
+
+    size_t intervalCount() const { return sources.size(); }
+    int64_t intervalId(size_t slot) const { return base_id + static_cast<int64_t>(slot); }
+    const SpaceSavingSketch& sourceSketch(size_t slot) const { return sources[slot]; }
+    const SpaceSavingSketch& destinationSketch(size_t slot) const { return destinations[slot]; }
+
+    // Gabungan seluruh interval (mis. untuk laporan harian)
+    SpaceSavingSketch combined(bool by_source) const;
+};
+
+#endif // HEAVY_HITTERS_H
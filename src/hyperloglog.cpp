@@ -0,0 +1,176 @@
+#include "hyperloglog.h"
+#include <algorithm>
+#include <cmath>
+
+HyperLogLog::HyperLogLog(int precision_bits) : precision(precision_bits) {
+    if (precision < MIN_PRECISION) precision = MIN_PRECISION;
+    if (precision > MAX_PRECISION) precision = MAX_PRECISION;
+}
+
+void HyperLogLog::addHash(uint64_t hash) {
+    // p bit teratas memilih register, sisanya menentukan rank
+    uint32_t index = static_cast<uint32_t>(hash >> (64 - precision));
+    uint64_t rest = hash << precision;
+    uint8_t rank = 1;
+    while (rank <= 64 - precision && (rest & 0x8000000000000000ULL) == 0) {
+        rest <<= 1;
+        rank++;
+    }
+
+    if (!registers.empty()) {
+        if (registers[index] < rank) registers[index] = rank;
+        return;
+    }
+
+    // Mode sparse: cari register di daftar terurut
+    uint32_t entry = (index << 8) | rank;
+    std::vector<uint32_t>::iterator it = std::lower_bound(sparse.begin(), sparse.end(), index << 8);
+    if (it != sparse.end() && (*it >> 8) == index) {
+        if ((*it & 0xff) < rank) *it = entry;
+        return;
+    }
+    sparse.insert(it, entry);
+    if (sparse.size() > sparseLimit()) toDense();
+}
+
+void HyperLogLog::toDense() {
+    registers.assign(static_cast<size_t>(1) << precision, 0);
+    for (uint32_t entry : sparse) {
+        registers[entry >> 8] = static_cast<uint8_t>(entry & 0xff);
+    }
+    std::vector<uint32_t>().swap(sparse);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    if (other.empty()) return;
+    if (other.precision != precision) return; // Register tidak sebanding
+
+    if (isSparse() && other.isSparse()) {
+        // Gabungkan dua daftar terurut, ambil rank maksimum per register
+        std::vector<uint32_t> merged;
+        merged.reserve(sparse.size() + other.sparse.size());
+        size_t i = 0, j = 0;
+        while (i < sparse.size() || j < other.sparse.size()) {
+            if (j == other.sparse.size() || (i < sparse.size() && (sparse[i] >> 8) < (other.sparse[j] >> 8))) {
+                merged.push_back(sparse[i++]);
+            } else if (i == sparse.size() || (other.sparse[j] >> 8) < (sparse[i] >> 8)) {
+                merged.push_back(other.sparse[j++]);
+            } else {
+                merged.push_back(std::max(sparse[i++], other.sparse[j++]));
+            }
+        }
+        sparse.swap(merged);
+        if (sparse.size() > sparseLimit()) toDense();
+        return;
+    }
+
+    if (isSparse()) toDense();
+    if (other.isSparse()) {
+        for (uint32_t entry : other.sparse) {
+            uint8_t rank = static_cast<uint8_t>(entry & 0xff);
+            if (registers[entry >> 8] < rank) registers[entry >> 8] = rank;
+        }
+    } else {
+        for (size_t i = 0; i < registers.size(); i++) {
+            if (registers[i] < other.registers[i]) registers[i] = other.registers[i];
+        }
+    }
+}
+
+double HyperLogLog::estimate() const {
+    if (empty()) return 0.0;
+
+    double m = static_cast<double>(static_cast<size_t>(1) << precision);
+    double alpha;
+    if (precision == 4) alpha = 0.673;
+    else if (precision == 5) alpha = 0.697;
+    else if (precision == 6) alpha = 0.709;
+    else alpha = 0.7213 / (1.0 + 1.079 / m);
+
+    // Rata-rata harmonik 2^-rank; register kosong menyumbang 2^0
+    double sum = 0.0;
+    size_t zeros = 0;
+    if (isSparse()) {
+        zeros = static_cast<size_t>(m) - sparse.size();
+        sum = static_cast<double>(zeros);
+        for (uint32_t entry : sparse) sum += std::ldexp(1.0, -static_cast<int>(entry & 0xff));
+    } else {
+        for (uint8_t rank : registers) {
+            if (rank == 0) zeros++;
+            sum += std::ldexp(1.0, -static_cast<int>(rank));
+        }
+    }
+
+    double raw = alpha * m * m / sum;
+    // Koreksi rentang kecil: linear counting selama masih ada register kosong
+    if (raw <= 2.5 * m && zeros > 0) {
+        return m * std::log(m / static_cast<double>(zeros));
+    }
+    return raw; // Hash 64-bit: koreksi rentang besar tidak diperlukan
+}
+
+double HyperLogLog::standardError() const {
+    return 1.04 / std::sqrt(static_cast<double>(static_cast<size_t>(1) << precision));
+}
+
+const int64_t DistinctHostTracker::MAX_SPAN_INTERVALS;
+
+DistinctHostTracker::DistinctHostTracker(int precision_bits, int64_t max_span_intervals)
+    : precision(precision_bits), base_id(0), max_span(max_span_intervals) {}
+
+bool DistinctHostTracker::slotFor(int64_t interval_id, size_t& slot) {
+    if (sources.empty()) {
+        base_id = interval_id;
+        sources.assign(1, HyperLogLog(precision));
+        destinations.assign(1, HyperLogLog(precision));
+        slot = 0;
+        return true;
+    }
+    // Batas rentang seperti TrafficAggregate (selisih unsigned: id bisa jauh)
+    int64_t last_id = base_id + static_cast<int64_t>(sources.size()) - 1;
+    uint64_t span = static_cast<uint64_t>(std::max(last_id, interval_id)) -
+                    static_cast<uint64_t>(std::min(base_id, interval_id));
+    if (span >= static_cast<uint64_t>(max_span)) return false;
+    if (interval_id < base_id) {
+        // Paket sebelum interval pertama (capture tidak terurut)
+        size_t shift = static_cast<size_t>(base_id - interval_id);
+        sources.insert(sources.begin(), shift, HyperLogLog(precision));
+        destinations.insert(destinations.begin(), shift, HyperLogLog(precision));
+        base_id = interval_id;
+        slot = 0;
+        return true;
+    }
+    slot = static_cast<size_t>(interval_id - base_id);
+    if (slot >= sources.size()) {
+        sources.resize(slot + 1, HyperLogLog(precision));
+        destinations.resize(slot + 1, HyperLogLog(precision));
+    }
+    return true;
+}
+
+void DistinctHostTracker::merge(const DistinctHostTracker& other) {
+    for (size_t i = 0; i < other.sources.size(); i++) {
+        if (other.sources[i].empty()) continue;
+        size_t slot;
+        if (!slotFor(other.base_id + static_cast<int64_t>(i), slot)) continue; // Di luar rentang (outlier di agregat link)
+        sources[slot].merge(other.sources[i]);
+        destinations[slot].merge(other.destinations[i]);
+    }
+}
+
+double DistinctHostTracker::estimate(int64_t interval_id, bool by_source) const {
+    if (interval_id < base_id || interval_id - base_id >= static_cast<int64_t>(sources.size())) return 0.0;
+    size_t slot = static_cast<size_t>(interval_id - base_id);
+    return by_source ? sources[slot].estimate() : destinations[slot].estimate();
+}
+
+HyperLogLog DistinctHostTracker::combined(int64_t first_id, int64_t last_id, bool by_source) const {
+    HyperLogLog result(precision > 0 ? precision : 12);
+    const std::vector<HyperLogLog>& sketches = by_source ? sources : destinations;
+    int64_t begin = std::max(first_id, base_id);
+    int64_t end = std::min(last_id, base_id + static_cast<int64_t>(sketches.size()) - 1);
+    for (int64_t id = begin; id <= end; id++) {
+        result.merge(sketches[static_cast<size_t>(id - base_id)]);
+    }
+    return result;
+}
@@ -0,0 +1,87 @@
+#ifndef HYPERLOGLOG_H
+#define HYPERLOGLOG_H
+
+#include "ip_address.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Penghitung kardinalitas HyperLogLog (Flajolet dkk.) untuk jumlah host
+// unik. Dengan presisi p terdapat m = 2^p register 1 byte dan galat
+// standar ~1.04/sqrt(m) (p = 12 -> ~1.6%, 4 KB). Sketch yang masih
+// kecil disimpan sparse (daftar register terurut) agar interval dengan
+// sedikit host tidak memakan m byte; otomatis berubah dense saat penuh.
+// Dua sketch dengan presisi sama bisa digabung (union) tanpa kehilangan
+// akurasi, sehingga interval bisa dijumlahkan menjadi per jam/hari.
+class HyperLogLog {
+public:
+    static const int MIN_PRECISION = 4;
+    static const int MAX_PRECISION = 16;
+
+private:
+    int precision;
+    std::vector<uint8_t> registers; // Dense: m register (kosong = mode sparse)
+    std::vector<uint32_t> sparse;   // Sparse: (indeks << 8) | rank, terurut
+
+    size_t sparseLimit() const { return (static_cast<size_t>(1) << precision) / 8; }
+    void toDense();
+    void addHash(uint64_t hash);
+
+public:
+    explicit HyperLogLog(int precision_bits = 12);
+
+    static bool isValidPrecision(int bits) {
+        return bits >= MIN_PRECISION && bits <= MAX_PRECISION;
+    }
+
+    void add(const IpAddress& host) { addHash(hashIp(host)); }
+    void merge(const HyperLogLog& other);
+
+    double estimate() const;
+    int getPrecision() const { return precision; }
+    bool empty() const { return registers.empty() && sparse.empty(); }
+    bool isSparse() const { return registers.empty(); }
+    // Galat standar relatif (mis. 0.016 untuk p = 12)
+    double standardError() const;
+};
+
+// Pasangan HyperLogLog (source, destination) untuk setiap interval
+// agregasi, diindeks langsung seperti TrafficAggregate.
+class DistinctHostTracker {
+private:
+    int precision; // 0 = nonaktif
+    int64_t base_id;
+    int64_t max_span; // Jumlah interval maksimum [pertama, terakhir]
+    std::vector<HyperLogLog> sources;
+    std::vector<HyperLogLog> destinations;
+
+    // false jika interval memperlebar rentang melewati max_span
+    bool slotFor(int64_t interval_id, size_t& slot);
+
+public:
+    static const int64_t MAX_SPAN_INTERVALS = int64_t(1) << 23; // Sama dengan TrafficAggregate
+
+    explicit DistinctHostTracker(int precision_bits = 0, int64_t max_span_intervals = MAX_SPAN_INTERVALS);
+
+    bool enabled() const { return precision > 0; }
+    int getPrecision() const { return precision; }
+
+    void add(int64_t interval_id, const IpAddress& src, const IpAddress& dst) {
+        size_t slot;
+        if (!slotFor(interval_id, slot)) return;
+        sources[slot].add(src);
+        destinations[slot].add(dst);
+    }
+
+    void merge(const DistinctHostTracker& other);
+
+    // Estimasi satu interval (0 jika interval tidak punya paket)
+    double estimate(int64_t interval_id, bool by_source) const;
+    // Union interval [first_id, last_id], mis. 12 interval 5 menit = 1 jam
+    HyperLogLog combined(int64_t first_id, int64_t last_id, bool by_source) const;
+
+    size_t intervalCount() const { return sources.size(); }
+    int64_t firstIntervalId() const { return base_id; }
+};
+
+#endif // HYPERLOGLOG_H
@@ -0,0 +1,96 @@
+#include "ingest_pipeline.h"
+#include "csv_fast_parse.h"
+
+IngestPipeline::IngestPipeline(const IngestOptions& ingest_options)
+    : options(ingest_options), has_origin(false),
+      link(0.0, ingest_options.interval_seconds),
+      rollup_base(RollupPyramid::makeBaseAggregate()),
+      heavy(ingest_options.heavy_hitter_capacity, TrafficAggregate::MAX_SPAN_BUCKETS),
+      distinct(ingest_options.distinct_precision, TrafficAggregate::MAX_SPAN_BUCKETS) {}
+
+bool IngestPipeline::parseLine(const char*& p, const char* end, PacketRecord& record) {
+    record.has_flow = false;
+    bool ok = csvparse::parseDouble(p, end, record.timestamp);
+    if (ok) {
+        csvparse::skipField(p, end); // Sisa field timestamp
+        csvparse::skipField(p, end); // Source IP
+        csvparse::skipField(p, end); // Dest IP
+        csvparse::skipField(p, end); // Protocol
+        ok = csvparse::parseInt64(p, end, record.length);
+    }
+    csvparse::skipLine(p, end);
+    return ok;
+}
+
+// Parse field alamat IP. Jalur cepat membaca IPv4 langsung dari buffer
+// dalam satu lintasan; selain itu (IPv6, tanda kutip) memakai parser umum.
+static bool parseIpField(const char*& p, const char* end, IpAddress& out) {
+    const char* q = p;
+    uint32_t address = 0;
+    int part = 0;
+    while (part < 4) {
+        uint32_t octet = 0;
+        const char* digits_start = q;
+        while (q < end && csvparse::isDigit(*q) && q - digits_start < 3) {
+            octet = octet * 10 + static_cast<uint32_t>(*q - '0');
+            ++q;
+        }
+        if (q == digits_start || octet > 255) break;
+        address = (address << 8) | octet;
+        if (++part < 4) {
+            if (q >= end || *q != '.') break;
+            ++q;
+        }
+    }
+    if (part == 4 && (q == end || *q == ',')) {
+        out = IpAddress::fromV4(address);
+        p = (q < end) ? q + 1 : q;
+        return true;
+    }
+
+    const char *field_begin, *field_end;
+    csvparse::fieldRange(p, end, field_begin, field_end);
+    return IpAddress::parse(field_begin, field_end, out);
+}
+
+bool IngestPipeline::parse(const char*& p, const char* end, PacketRecord& record) {
+    // Alamat IP hanya diparse jika ada tahap yang membutuhkannya
+    if (!options.needsAddresses()) return parseLine(p, end, record);
+
+    record.has_flow = false;
+    bool ok = csvparse::parseDouble(p, end, record.timestamp);
+    if (ok) {
+        csvparse::skipField(p, end); // Sisa field timestamp
+
+        bool src_ok = parseIpField(p, end, record.flow.src);
+        bool dst_ok = parseIpField(p, end, record.flow.dst);
+        const char *proto_begin, *proto_end;
+        csvparse::fieldRange(p, end, proto_begin, proto_end);
+        ok = csvparse::parseInt64(p, end, record.length);
+
+        if (ok && src_ok && dst_ok) {
+            record.flow.protocol = flows.internProtocol(proto_begin, proto_end);
+            record.has_flow = true;
+        }
+    }
+    csvparse::skipLine(p, end);
+    return ok;
+}
+
+void IngestPipeline::setOrigin(double origin) {
+    link = TrafficAggregate(origin, options.interval_seconds);
+    has_origin = true;
+}
+
+void IngestPipeline::merge(const IngestPipeline& other) {
+    if (!other.has_origin) return;
+    if (!has_origin) {
+        *this = other;
+        return;
+    }
+    link.merge(other.link);
+    rollup_base.merge(other.rollup_base);
+    flows.merge(other.flows);
+    heavy.merge(other.heavy);
+    distinct.merge(other.distinct);
+}
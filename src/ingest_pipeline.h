@@ -0,0 +1,87 @@
+#ifndef INGEST_PIPELINE_H
+#define INGEST_PIPELINE_H
+
+#include "traffic_aggregator.h"
+#include "rollup_pyramid.h"
+#include "flow_aggregator.h"
+#include "heavy_hitters.h"
+#include "hyperloglog.h"
+#include <cstdint>
+
+// Satu paket hasil parsing baris CSV mentah
+struct PacketRecord {
+    double timestamp;
+    int64_t length;
+    FlowKey flow;  // Hanya diisi jika alamat IP diparse (flow / heavy hitter / HLL)
+    bool has_flow; // false jika IP tidak valid (mis. ARP) atau tidak diparse
+};
+
+// Opsi ingest yang diambil dari NetworkAnalyzer
+struct IngestOptions {
+    double interval_seconds; // Lebar interval agregasi utama
+    bool build_rollup;       // Isi juga level dasar piramida rollup
+    bool aggregate_flows;    // Agregasi per-flow (src IP, dst IP, protokol)
+    size_t heavy_hitter_capacity; // Counter Space-Saving per interval (0 = nonaktif)
+    int distinct_precision;       // Presisi HyperLogLog host unik (0 = nonaktif)
+
+    bool needsAddresses() const {
+        return aggregate_flows || heavy_hitter_capacity > 0 || distinct_precision > 0;
+    }
+};
+
+// Semua agregat yang diisi selama satu pass ingest. Loader sekuensial
+// memakai satu objek; loader paralel memakai satu objek per thread lalu
+// menggabungkannya dengan merge(). Menambah tahap agregasi baru cukup
+// dilakukan di sini, bukan di setiap loader.
+class IngestPipeline {
+private:
+    IngestOptions options;
+    bool has_origin;
+    TrafficAggregate link;        // Interval utama (origin = paket pertama)
+    TrafficAggregate rollup_base; // Level dasar rollup (1 detik, sejajar epoch)
+    FlowAggregator flows;         // Byte/paket per flow per interval
+    HeavyHitterTracker heavy;     // Top talker per interval (memori tetap)
+    DistinctHostTracker distinct; // Jumlah host unik per interval (HyperLogLog)
+
+public:
+    explicit IngestPipeline(const IngestOptions& ingest_options);
+
+    // Parse satu baris CSV: Timestamp,Source IP,Destination IP,Protocol,Length.
+    // p dimajukan ke awal baris berikutnya. Mengembalikan false jika baris
+    // tidak memiliki timestamp atau Length kosong. Versi statis hanya
+    // membaca timestamp dan Length; parse() juga membaca field flow jika
+    // agregasi flow aktif (protokol di-intern ke tabel milik pipeline ini).
+    static bool parseLine(const char*& p, const char* end, PacketRecord& record);
+    bool parse(const char*& p, const char* end, PacketRecord& record);
+
+    // Tetapkan origin interval utama (dipakai loader paralel agar semua
+    // partial memakai origin yang sama). Jika tidak dipanggil, origin
+    // diambil dari paket pertama yang ditambahkan.
+    void setOrigin(double origin);
+
+    void add(const PacketRecord& record) {
+        if (!has_origin) setOrigin(record.timestamp);
+        int64_t interval_id = link.intervalId(record.timestamp);
+        bool accepted = link.addToInterval(interval_id, record.length);
+        if (options.build_rollup) rollup_base.add(record.timestamp, record.length);
+        // Paket outlier tidak diteruskan: id-nya bisa jauh di luar rentang
+        // dan memaksa tracker per interval mengalokasikan slot tanpa batas
+        if (accepted && record.has_flow) {
+            if (options.aggregate_flows) flows.add(record.flow, interval_id, record.length);
+            if (heavy.enabled()) heavy.add(interval_id, record.flow.src, record.flow.dst, record.length);
+            if (distinct.enabled()) distinct.add(interval_id, record.flow.src, record.flow.dst);
+        }
+    }
+
+    void merge(const IngestPipeline& other);
+
+    bool hasPackets() const { return has_origin && !link.empty(); }
+    const TrafficAggregate& getLinkAggregate() const { return link; }
+    const TrafficAggregate& getRollupBase() const { return rollup_base; }
+    const FlowAggregator& getFlows() const { return flows; }
+    const HeavyHitterTracker& getHeavyHitters() const { return heavy; }
+    const DistinctHostTracker& getDistinctHosts() const { return distinct; }
+    const IngestOptions& getOptions() const { return options; }
+};
+
+#endif // INGEST_PIPELINE_H
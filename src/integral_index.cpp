@@ -0,0 +1,96 @@
+#include "integral_index.h"
+#include <algorithm>
+
+void CumulativeIntegralIndex::build(const double* x, const double* y, size_t n) {
+    xs.assign(x, x + n);
+    ys.assign(y, y + n);
+    even_prefix.assign(n + 1, 0.0);
+    odd_prefix.assign(n + 1, 0.0);
+    trapezoid_prefix.assign(n, 0.0);
+
+    for (size_t k = 0; k < n; k++) {
+        even_prefix[k + 1] = even_prefix[k] + (k % 2 == 0 ? y[k] : 0.0);
+        odd_prefix[k + 1] = odd_prefix[k] + (k % 2 == 1 ? y[k] : 0.0);
+        if (k > 0) {
+            trapezoid_prefix[k] = trapezoid_prefix[k - 1] + (x[k] - x[k - 1]) * (y[k] + y[k - 1]) / 2.0;
+        }
+    }
+}
+
+void CumulativeIntegralIndex::clear() {
+    xs.clear();
+    ys.clear();
+    even_prefix.clear();
+    odd_prefix.clear();
+    trapezoid_prefix.clear();
+}
+
+double CumulativeIntegralIndex::paritySum(size_t first, size_t last, size_t parity) const {
+    // Jumlah y[m] untuk first <= m <= last dengan m % 2 == parity
+    if (first > last) return 0.0;
+    const std::vector<double>& prefix = (parity == 0) ? even_prefix : odd_prefix;
+    return prefix[last + 1] - prefix[first];
+}
+
+bool CumulativeIntegralIndex::simpson(double start, double end, double& result) const {
+    size_t first = static_cast<size_t>(std::lower_bound(xs.begin(), xs.end(), start) - xs.begin());
+    size_t past = static_cast<size_t>(std::upper_bound(xs.begin(), xs.end(), end) - xs.begin());
+    if (past < first + 3) return false;
+
+    // Simpson 1/3 pada jumlah interval genap; jika ganjil, tiga interval
+    // terakhir memakai aturan 3/8 sehingga tidak ada interval yang dibuang
+    size_t n = past - first - 1;
+    size_t m = (n % 2 == 0) ? n : n - 3;
+    size_t last = first + m;
+
+    double h = (xs[first + n] - xs[first]) / n;
+    double sum = 0.0;
+    if (m > 0) {
+        sum = ys[first] + ys[last];
+        sum += 4.0 * paritySum(first + 1, last - 1, (first + 1) % 2);
+        if (m >= 4) sum += 2.0 * paritySum(first + 2, last - 2, first % 2);
+    }
+    result = sum * h / 3.0;
+    if (m < n) {
+        result += 3.0 * h / 8.0 * (ys[last] + 3.0 * ys[last + 1] + 3.0 * ys[last + 2] + ys[last + 3]);
+    }
+    return true;
+}
+
+double CumulativeIntegralIndex::linearAt(size_t segment, double x) const {
+    double width = xs[segment + 1] - xs[segment];
+    if (width == 0.0) return ys[segment + 1]; // x duplikat
+    double t = (x - xs[segment]) / width;
+    return ys[segment] + (ys[segment + 1] - ys[segment]) * t;
+}
+
+double CumulativeIntegralIndex::trapezoid(double start, double end) const {
+    if (xs.size() < 2) return 0.0;
+    double sign = 1.0;
+    if (start > end) {
+        std::swap(start, end);
+        sign = -1.0;
+    }
+    // Di luar data tidak ada kontribusi
+    start = std::max(start, xs.front());
+    end = std::min(end, xs.back());
+    if (start >= end) return 0.0;
+
+    // Segmen yang memuat kedua batas
+    size_t last_segment = xs.size() - 2;
+    size_t a = std::min(static_cast<size_t>(std::upper_bound(xs.begin(), xs.end(), start) - xs.begin()) - 1, last_segment);
+    size_t b = std::min(static_cast<size_t>(std::upper_bound(xs.begin(), xs.end(), end) - xs.begin()) - 1, last_segment);
+
+    double y_start = linearAt(a, start);
+    double y_end = linearAt(b, end);
+    double total;
+    if (a == b) {
+        total = (end - start) * (y_start + y_end) / 2.0;
+    } else {
+        // [start, x[a+1]] + prefix x[a+1]..x[b] + [x[b], end]
+        total = (xs[a + 1] - start) * (y_start + ys[a + 1]) / 2.0
+              + (trapezoid_prefix[b] - trapezoid_prefix[a + 1])
+              + (end - xs[b]) * (ys[b] + y_end) / 2.0;
+    }
+    return sign * total;
+}
@@ -0,0 +1,38 @@
+#ifndef INTEGRAL_INDEX_H
+#define INTEGRAL_INDEX_H
+
+#include <vector>
+#include <cstddef>
+
+// Indeks integral kumulatif untuk satu deret (x naik). Dibangun sekali
+// dalam O(n); setiap query rentang hanya dua pencarian biner ditambah
+// koreksi batas, tanpa alokasi:
+//  - simpson(): aturan Simpson komposit pada titik di [start, end] dengan
+//    semantik yang sama seperti NetworkAnalyzer::simpsonIntegration,
+//    dari prefix sum y berindeks genap/ganjil (bobot 1-4-2-...-4-1);
+//    jumlah interval ganjil ditutup aturan 3/8 pada tiga interval terakhir
+//  - trapezoid(): integral interpolasi linear dengan batas sembarang,
+//    dari prefix integral trapesium ditambah potongan di kedua batas
+class CumulativeIntegralIndex {
+private:
+    std::vector<double> xs;
+    std::vector<double> ys;
+    std::vector<double> even_prefix;     // Jumlah y[m], m < k, m genap
+    std::vector<double> odd_prefix;      // Jumlah y[m], m < k, m ganjil
+    std::vector<double> trapezoid_prefix; // Integral trapesium x[0]..x[k]
+
+    double paritySum(size_t first, size_t last, size_t parity) const;
+    double linearAt(size_t segment, double x) const;
+
+public:
+    void build(const double* x, const double* y, size_t n);
+    void clear();
+    bool empty() const { return xs.empty(); }
+    size_t size() const { return xs.size(); }
+
+    // false jika titik dalam rentang kurang dari 3
+    bool simpson(double start, double end, double& result) const;
+    double trapezoid(double start, double end) const;
+};
+
+#endif // INTEGRAL_INDEX_H
@@ -0,0 +1,193 @@
+#include "interpolation_engine.h"
+#include <algorithm>
+#include <cmath>
+
+InterpolationEngine::InterpolationEngine() : method(InterpolationMethod::Linear), degree(1) {}
+
+const char* InterpolationEngine::methodName(InterpolationMethod interpolation_method) {
+    switch (interpolation_method) {
+        case InterpolationMethod::Linear: return "Linear";
+        case InterpolationMethod::Barycentric: return "Lagrange barycentric";
+        case InterpolationMethod::NaturalSpline: return "Spline kubik natural";
+        case InterpolationMethod::MonotoneSpline: return "Spline kubik monoton";
+    }
+    return "-";
+}
+
+bool InterpolationEngine::build(const double* x, const double* y, size_t n,
+                                InterpolationMethod interpolation_method, int barycentric_degree) {
+    xs.clear();
+    ys.clear();
+    if (n < 2) return false;
+    for (size_t i = 1; i < n; i++) {
+        if (!(x[i] > x[i - 1])) return false; // Juga menolak NaN
+    }
+
+    method = interpolation_method;
+    xs.assign(x, x + n);
+    ys.assign(y, y + n);
+    coef_a.clear();
+    coef_b.clear();
+    coef_c.clear();
+    coef_d.clear();
+    weights.clear();
+
+    switch (method) {
+        case InterpolationMethod::Linear:
+            buildLinear();
+            break;
+        case InterpolationMethod::NaturalSpline:
+            buildNaturalSpline();
+            break;
+        case InterpolationMethod::MonotoneSpline:
+            buildMonotoneSpline();
+            break;
+        case InterpolationMethod::Barycentric:
+            degree = std::max(1, std::min(barycentric_degree, MAX_DEGREE));
+            if (static_cast<size_t>(degree) > n - 1) degree = static_cast<int>(n - 1);
+            buildBarycentric();
+            break;
+    }
+    return true;
+}
+
+void InterpolationEngine::buildLinear() {
+    size_t segments = xs.size() - 1;
+    coef_a.assign(ys.begin(), ys.end() - 1);
+    coef_b.resize(segments);
+    coef_c.assign(segments, 0.0);
+    coef_d.assign(segments, 0.0);
+    for (size_t i = 0; i < segments; i++) {
+        coef_b[i] = (ys[i + 1] - ys[i]) / (xs[i + 1] - xs[i]);
+    }
+}
+
+void InterpolationEngine::buildNaturalSpline() {
+    size_t n = xs.size();
+    size_t segments = n - 1;
+    std::vector<double> h(segments);
+    for (size_t i = 0; i < segments; i++) h[i] = xs[i + 1] - xs[i];
+
+    // Sistem tridiagonal untuk turunan kedua M (M[0] = M[n-1] = 0),
+    // diselesaikan dengan algoritma Thomas dalam O(n)
+    std::vector<double> m(n, 0.0);
+    if (n > 2) {
+        std::vector<double> diag(n), rhs(n);
+        for (size_t i = 1; i < n - 1; i++) {
+            diag[i] = 2.0 * (h[i - 1] + h[i]);
+            rhs[i] = 6.0 * ((ys[i + 1] - ys[i]) / h[i] - (ys[i] - ys[i - 1]) / h[i - 1]);
+        }
+        for (size_t i = 2; i < n - 1; i++) {
+            double factor = h[i - 1] / diag[i - 1];
+            diag[i] -= factor * h[i - 1];
+            rhs[i] -= factor * rhs[i - 1];
+        }
+        for (size_t i = n - 2; i >= 1; i--) {
+            m[i] = (rhs[i] - h[i] * m[i + 1]) / diag[i];
+        }
+    }
+
+    coef_a.assign(ys.begin(), ys.end() - 1);
+    coef_b.resize(segments);
+    coef_c.resize(segments);
+    coef_d.resize(segments);
+    for (size_t i = 0; i < segments; i++) {
+        coef_b[i] = (ys[i + 1] - ys[i]) / h[i] - h[i] * (2.0 * m[i] + m[i + 1]) / 6.0;
+        coef_c[i] = m[i] / 2.0;
+        coef_d[i] = (m[i + 1] - m[i]) / (6.0 * h[i]);
+    }
+}
+
+void InterpolationEngine::buildMonotoneSpline() {
+    size_t n = xs.size();
+    size_t segments = n - 1;
+    std::vector<double> h(segments), delta(segments);
+    for (size_t i = 0; i < segments; i++) {
+        h[i] = xs[i + 1] - xs[i];
+        delta[i] = (ys[i + 1] - ys[i]) / h[i];
+    }
+
+    // Turunan di titik: rata-rata harmonik berbobot (Fritsch-Butland),
+    // nol di titik ekstrem lokal sehingga tidak ada overshoot
+    std::vector<double> slope(n);
+    slope[0] = delta[0];
+    slope[n - 1] = delta[segments - 1];
+    for (size_t i = 1; i < n - 1; i++) {
+        if (delta[i - 1] * delta[i] <= 0.0) {
+            slope[i] = 0.0;
+        } else {
+            double w1 = 2.0 * h[i] + h[i - 1];
+            double w2 = h[i] + 2.0 * h[i - 1];
+            slope[i] = (w1 + w2) / (w1 / delta[i - 1] + w2 / delta[i]);
+        }
+    }
+
+    coef_a.assign(ys.begin(), ys.end() - 1);
+    coef_b.assign(slope.begin(), slope.end() - 1);
+    coef_c.resize(segments);
+    coef_d.resize(segments);
+    for (size_t i = 0; i < segments; i++) {
+        coef_c[i] = (3.0 * delta[i] - 2.0 * slope[i] - slope[i + 1]) / h[i];
+        coef_d[i] = (slope[i] + slope[i + 1] - 2.0 * delta[i]) / (h[i] * h[i]);
+    }
+}
+
+void InterpolationEngine::buildBarycentric() {
+    // Bobot w_j = 1 / prod_{k != j} (x_j - x_k) untuk setiap jendela
+    // degree + 1 titik berurutan; disimpan rata per posisi awal jendela
+    size_t window = static_cast<size_t>(degree) + 1;
+    size_t starts = xs.size() - window + 1;
+    weights.resize(starts * window);
+    for (size_t s = 0; s < starts; s++) {
+        for (size_t j = 0; j < window; j++) {
+            double product = 1.0;
+            for (size_t k = 0; k < window; k++) {
+                if (k != j) product *= xs[s + j] - xs[s + k];
+            }
+            weights[s * window + j] = 1.0 / product;
+        }
+    }
+}
+
+size_t InterpolationEngine::segmentOf(double x) const {
+    // Segmen i dengan xs[i] <= x < xs[i+1], dibatasi ke [0, n-2]
+    size_t upper = static_cast<size_t>(std::upper_bound(xs.begin(), xs.end(), x) - xs.begin());
+    if (upper == 0) return 0;
+    return std::min(upper - 1, xs.size() - 2);
+}
+
+double InterpolationEngine::evaluateBarycentric(size_t segment, double x) const {
+    // Jendela dipusatkan pada segmen, digeser di dekat ujung deret
+    size_t window = static_cast<size_t>(degree) + 1;
+    size_t starts = xs.size() - window + 1;
+    size_t offset = static_cast<size_t>(degree - 1) / 2;
+    size_t start = segment > offset ? segment - offset : 0;
+    if (start >= starts) start = starts - 1;
+
+    const double* w = &weights[start * window];
+    double numerator = 0.0, denominator = 0.0;
+    for (size_t j = 0; j < window; j++) {
+        double diff = x - xs[start + j];
+        if (diff == 0.0) return ys[start + j];
+        double term = w[j] / diff;
+        numerator += term * ys[start + j];
+        denominator += term;
+    }
+    return numerator / denominator;
+}
+
+double InterpolationEngine::evaluate(double x) const {
+    if (xs.empty()) return 0.0;
+    if (x <= xs.front()) return ys.front();
+    if (x >= xs.back()) return ys.back();
+
+    size_t segment = segmentOf(x);
+    if (method == InterpolationMethod::Barycentric) return evaluateBarycentric(segment, x);
+
+    double t = x - xs[segment];
+    return coef_a[segment] + t * (coef_b[segment] + t * (coef_c[segment] + t * coef_d[segment]));
+}
+
+void InterpolationEngine::evaluate(const double* x, size_t count, double* results) const {
+    for (size_t i = 0; i < count; i++) results[i] = evaluate(x[i]);
+}
@@ -0,0 +1,63 @@
+#ifndef INTERPOLATION_ENGINE_H
+#define INTERPOLATION_ENGINE_H
+
+#include <vector>
+#include <cstddef>
+
+enum class InterpolationMethod {
+    Linear,
+    Barycentric,    // Lagrange barycentric pada jendela lokal (derajat tetap)
+    NaturalSpline,  // Spline kubik natural (turunan kedua 0 di ujung)
+    MonotoneSpline  // Spline kubik monoton (Fritsch-Carlson / PCHIP)
+};
+
+// Mesin interpolasi untuk deret sembarang panjang dengan x tidak seragam
+// (mis. timestamp interval resolusi penuh). Bobot barycentric dan
+// koefisien spline dihitung sekali di build(); setiap query hanya
+// pencarian biner segmen (O(log n)) ditambah evaluasi polinom.
+// Di luar rentang data, nilai ujung terdekat dikembalikan (tanpa
+// ekstrapolasi polinom yang bisa meledak).
+class InterpolationEngine {
+public:
+    static const int DEFAULT_DEGREE = 3;
+    static const int MAX_DEGREE = 10;
+
+private:
+    InterpolationMethod method;
+    int degree; // Derajat barycentric efektif (jendela = degree + 1 titik)
+    std::vector<double> xs;
+    std::vector<double> ys;
+    // Koefisien per segmen: y = a + b*t + c*t^2 + d*t^3, t = x - xs[i]
+    std::vector<double> coef_a, coef_b, coef_c, coef_d;
+    // Bobot barycentric untuk setiap posisi awal jendela
+    std::vector<double> weights;
+
+    void buildLinear();
+    void buildNaturalSpline();
+    void buildMonotoneSpline();
+    void buildBarycentric();
+    size_t segmentOf(double x) const;
+    double evaluateBarycentric(size_t segment, double x) const;
+
+public:
+    InterpolationEngine();
+
+    // x harus naik tegas dan minimal 2 titik; false jika tidak valid.
+    // degree hanya dipakai metode Barycentric (dipotong ke n - 1).
+    bool build(const double* x, const double* y, size_t n,
+               InterpolationMethod interpolation_method, int barycentric_degree = DEFAULT_DEGREE);
+
+    double evaluate(double x) const;
+    void evaluate(const double* x, size_t count, double* results) const;
+
+    bool ready() const { return xs.size() >= 2; }
+    size_t size() const { return xs.size(); }
+    InterpolationMethod getMethod() const { return method; }
+    int getDegree() const { return degree; }
+    double minX() const { return xs.empty() ? 0.0 : xs.front(); }
+    double maxX() const { return xs.empty() ? 0.0 : xs.back(); }
+
+    static const char* methodName(InterpolationMethod interpolation_method);
+};
+
+#endif // INTERPOLATION_ENGINE_H
@@ -0,0 +1,164 @@
+#ifndef IP_ADDRESS_H
+#define IP_ADDRESS_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Alamat IP kompak 128-bit. IPv4 disimpan sebagai IPv4-mapped IPv6
+// (::ffff:a.b.c.d) sehingga satu tipe bisa dipakai untuk keduanya tanpa
+// string. Nilai nol berarti alamat tidak valid / tidak terisi.
+struct IpAddress {
+    uint64_t hi;
+    uint64_t lo;
+
+    bool operator==(const IpAddress& other) const { return hi == other.hi && lo == other.lo; }
+    bool operator!=(const IpAddress& other) const { return !(*this == other); }
+    bool operator<(const IpAddress& other) const {
+        return hi < other.hi || (hi == other.hi && lo < other.lo);
+    }
+
+    bool isV4() const { return hi == 0 && (lo >> 32) == 0xffffu; }
+    uint32_t v4() const { return static_cast<uint32_t>(lo); }
+
+    static IpAddress fromV4(uint32_t address) {
+        IpAddress ip = {0, (uint64_t(0xffffu) << 32) | address};
+        return ip;
+    }
+
+    // Parse IPv4 (a.b.c.d) atau IPv6 (termasuk '::' dan ekor IPv4).
+    // Mengembalikan false jika teks bukan alamat yang valid.
+    static bool parse(const char* begin, const char* end, IpAddress& out);
+
+    std::string toString() const;
+};
+
+// Finalizer 64-bit (splitmix64): sebaran bit yang baik untuk hash table
+// open-addressing dan sketch probabilistik
+inline uint64_t mixHash64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+inline uint64_t hashIp(const IpAddress& ip) {
+    return mixHash64(ip.hi ^ mixHash64(ip.lo));
+}
+
+inline bool parseIpv4(const char* p, const char* end, uint32_t& out) {
+    uint32_t address = 0;
+    for (int part = 0; part < 4; part++) {
+        if (p >= end || static_cast<unsigned>(*p - '0') >= 10u) return false;
+        uint32_t octet = 0;
+        int digits = 0;
+        while (p < end && static_cast<unsigned>(*p - '0') < 10u) {
+            octet = octet * 10 + static_cast<uint32_t>(*p - '0');
+            if (++digits > 3 || octet > 255) return false;
+            ++p;
+        }
+        address = (address << 8) | octet;
+        if (part < 3) {
+            if (p >= end || *p != '.') return false;
+            ++p;
+        }
+    }
+    if (p != end) return false;
+    out = address;
+    return true;
+}
+
+inline bool IpAddress::parse(const char* begin, const char* end, IpAddress& out) {
+    // Jalur cepat IPv4
+    uint32_t v4_address;
+    if (parseIpv4(begin, end, v4_address)) {
+        out = fromV4(v4_address);
+        return true;
+    }
+
+    // IPv6: hingga 8 grup hex, satu '::' boleh mengompresi grup nol
+    uint16_t groups[8] = {0};
+    int count = 0;
+    int compress_at = -1;
+    const char* p = begin;
+
+    if (p + 1 < end && p[0] == ':' && p[1] == ':') {
+        compress_at = 0;
+        p += 2;
+    }
+    while (p < end && count < 8) {
+        const char* group_start = p;
+        uint32_t value = 0;
+        int digits = 0;
+        while (p < end && digits < 5) {
+            char c = *p;
+            uint32_t nibble;
+            if (c >= '0' && c <= '9') nibble = static_cast<uint32_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') nibble = static_cast<uint32_t>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') nibble = static_cast<uint32_t>(c - 'A' + 10);
+            else break;
+            value = (value << 4) | nibble;
+            ++digits;
+            ++p;
+        }
+        if (p < end && *p == '.') {
+            // Ekor IPv4 (misalnya ::ffff:10.0.0.1) mengisi dua grup terakhir
+            if (count > 6 || !parseIpv4(group_start, end, v4_address)) return false;
+            groups[count++] = static_cast<uint16_t>(v4_address >> 16);
+            groups[count++] = static_cast<uint16_t>(v4_address & 0xffffu);
+            p = end;
+            break;
+        }
+        if (digits == 0 || digits > 4) return false;
+        groups[count++] = static_cast<uint16_t>(value);
+        if (p == end) break;
+        if (*p != ':') return false;
+        ++p;
+        if (p < end && *p == ':') {
+            if (compress_at >= 0) return false;
+            compress_at = count;
+            ++p;
+        } else if (p == end) {
+            return false; // ':' di akhir tanpa grup
+        }
+    }
+    if (p != end) return false;
+
+    if (compress_at >= 0) {
+        if (count == 8) return false;
+        int tail = count - compress_at;
+        for (int i = 0; i < tail; i++) {
+            groups[7 - i] = groups[count - 1 - i];
+        }
+        for (int i = compress_at; i < 8 - tail; i++) {
+            groups[i] = 0;
+        }
+    } else if (count != 8) {
+        return false;
+    }
+
+    out.hi = 0;
+    out.lo = 0;
+    for (int i = 0; i < 4; i++) out.hi = (out.hi << 16) | groups[i];
+    for (int i = 4; i < 8; i++) out.lo = (out.lo << 16) | groups[i];
+    return true;
+}
+
+inline std::string IpAddress::toString() const {
+    char buffer[48];
+    if (isV4()) {
+        uint32_t a = v4();
+        std::snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u",
+                      (a >> 24) & 0xffu, (a >> 16) & 0xffu, (a >> 8) & 0xffu, a & 0xffu);
+        return buffer;
+    }
+    // Bentuk lengkap tanpa kompresi '::' (cukup untuk laporan dan CSV)
+    std::snprintf(buffer, sizeof(buffer), "%x:%x:%x:%x:%x:%x:%x:%x",
+                  static_cast<unsigned>((hi >> 48) & 0xffffu), static_cast<unsigned>((hi >> 32) & 0xffffu),
+                  static_cast<unsigned>((hi >> 16) & 0xffffu), static_cast<unsigned>(hi & 0xffffu),
+                  static_cast<unsigned>((lo >> 48) & 0xffffu), static_cast<unsigned>((lo >> 32) & 0xffffu),
+                  static_cast<unsigned>((lo >> 16) & 0xffffu), static_cast<unsigned>(lo & 0xffffu));
+    return buffer;
+}
+
+#endif // IP_ADDRESS_H
@@ -0,0 +1,263 @@
+#include "kll_sketch.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+static const char SKETCH_MAGIC[8] = {'N', 'T', 'K', 'L', 'L', 'S', 'K', 'T'};
+static const char DAILY_MAGIC[8] = {'N', 'T', 'K', 'L', 'L', 'D', 'A', 'Y'};
+static const uint32_t SKETCH_VERSION = 1;
+static const uint32_t ENDIAN_MARKER = 0x01020304;
+
+template <typename T>
+static void writeValue(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool readValue(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+KllSketch::KllSketch(size_t accuracy)
+    : k(accuracy), n(0), min_value(0.0), max_value(0.0), coin(0x2545f4914f6cdd1dULL),
+      stored(0), capacity_total(0), levels(1) {
+    if (k < MIN_K) k = MIN_K;
+    if (k > MAX_K) k = MAX_K;
+    updateCapacity();
+}
+
+size_t KllSketch::levelCapacity(size_t level) const {
+    // Level teratas berkapasitas k, setiap level di bawahnya 2/3 kali lipat
+    size_t depth = levels.size() - 1 - level;
+    double capacity = std::ceil(static_cast<double>(k) * std::pow(2.0 / 3.0, static_cast<double>(depth)));
+    return std::max(static_cast<size_t>(capacity), static_cast<size_t>(8));
+}
+
+void KllSketch::updateCapacity() {
+    capacity_total = 0;
+    for (size_t h = 0; h < levels.size(); h++) capacity_total += levelCapacity(h);
+}
+
+void KllSketch::compactOneLevel() {
+    // Level terendah yang penuh; level teratas bisa memicu level baru
+    size_t h = 0;
+    while (h + 1 < levels.size() && levels[h].size() < levelCapacity(h)) h++;
+    if (h + 1 == levels.size()) {
+        levels.push_back(std::vector<double>());
+        updateCapacity();
+    }
+
+    std::vector<double>& current = levels[h];
+    std::vector<double>& above = levels[h + 1];
+    std::sort(current.begin(), current.end());
+
+    // Jika ganjil, item pertama tetap di level ini agar bobot total = n
+    size_t keep = current.size() % 2;
+    coin ^= coin << 13;
+    coin ^= coin >> 7;
+    coin ^= coin << 17;
+    size_t offset = static_cast<size_t>(coin & 1);
+    size_t before = above.size();
+    for (size_t i = keep + offset; i < current.size(); i += 2) {
+        above.push_back(current[i]);
+    }
+    stored -= current.size() - keep - (above.size() - before);
+    current.resize(keep);
+}
+
+void KllSketch::add(double value) {
+    if (n == 0 || value < min_value) min_value = value;
+    if (n == 0 || value > max_value) max_value = value;
+    n++;
+    levels[0].push_back(value);
+    stored++;
+    if (stored >= capacity_total) compactOneLevel();
+}
+
+void KllSketch::merge(const KllSketch& other) {
+    if (other.n == 0) return;
+    if (n == 0 || other.min_value < min_value) min_value = other.min_value;
+    if (n == 0 || other.max_value > max_value) max_value = other.max_value;
+    n += other.n;
+
+    if (levels.size() < other.levels.size()) {
+        levels.resize(other.levels.size());
+        updateCapacity();
+    }
+    for (size_t h = 0; h < other.levels.size(); h++) {
+        levels[h].insert(levels[h].end(), other.levels[h].begin(), other.levels[h].end());
+    }
+    stored += other.stored;
+    while (stored >= capacity_total) compactOneLevel();
+}
+
+double KllSketch::quantile(double q) const {
+    if (n == 0) return 0.0;
+    if (q <= 0.0) return min_value;
+    if (q >= 1.0) return max_value;
+
+    std::vector<std::pair<double, uint64_t>> weighted;
+    weighted.reserve(retained());
+    for (size_t h = 0; h < levels.size(); h++) {
+        for (double value : levels[h]) {
+            weighted.push_back(std::make_pair(value, static_cast<uint64_t>(1) << h));
+        }
+    }
+    std::sort(weighted.begin(), weighted.end());
+
+    // Nilai terkecil dengan bobot kumulatif >= q * n
+    double target = q * static_cast<double>(n);
+    uint64_t cumulative = 0;
+    for (const auto& item : weighted) {
+        cumulative += item.second;
+        if (static_cast<double>(cumulative) >= target) return item.first;
+    }
+    return max_value;
+}
+
+double KllSketch::rank(double value) const {
+    if (n == 0) return 0.0;
+    uint64_t below = 0;
+    for (size_t h = 0; h < levels.size(); h++) {
+        for (double item : levels[h]) {
+            if (item <= value) below += static_cast<uint64_t>(1) << h;
+        }
+    }
+    return static_cast<double>(below) / static_cast<double>(n);
+}
+
+void KllSketch::write(std::ostream& out) const {
+    out.write(SKETCH_MAGIC, sizeof(SKETCH_MAGIC));
+    writeValue(out, SKETCH_VERSION);
+    writeValue(out, ENDIAN_MARKER);
+    writeValue(out, static_cast<uint32_t>(k));
+    writeValue(out, static_cast<uint32_t>(levels.size()));
+    writeValue(out, n);
+    writeValue(out, min_value);
+    writeValue(out, max_value);
+    writeValue(out, coin);
+    for (const auto& level : levels) {
+        writeValue(out, static_cast<uint64_t>(level.size()));
+        if (!level.empty()) {
+            out.write(reinterpret_cast<const char*>(level.data()), level.size() * sizeof(double));
+        }
+    }
+}
+
+bool KllSketch::read(std::istream& in) {
+    char magic[8];
+    uint32_t version, marker, accuracy, level_count;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, SKETCH_MAGIC, sizeof(magic)) != 0) return false;
+    if (!readValue(in, version) || version != SKETCH_VERSION) return false;
+    if (!readValue(in, marker) || marker != ENDIAN_MARKER) return false;
+    if (!readValue(in, accuracy) || !isValidK(accuracy)) return false;
+    if (!readValue(in, level_count) || level_count == 0 || level_count > 64) return false;
+
+    KllSketch loaded(accuracy);
+    if (!readValue(in, loaded.n) || !readValue(in, loaded.min_value) ||
+        !readValue(in, loaded.max_value) || !readValue(in, loaded.coin)) return false;
+    loaded.levels.assign(level_count, std::vector<double>());
+
+    // Bobot total level harus sama dengan n (menolak file rusak)
+    uint64_t weight = 0;
+    loaded.stored = 0;
+    for (uint32_t h = 0; h < level_count; h++) {
+        uint64_t size;
+        if (!readValue(in, size) || size > static_cast<uint64_t>(accuracy) * 4 + 512) return false;
+        loaded.levels[h].resize(static_cast<size_t>(size));
+        if (size > 0 && !in.read(reinterpret_cast<char*>(loaded.levels[h].data()), size * sizeof(double))) return false;
+        weight += size << h;
+        loaded.stored += static_cast<size_t>(size);
+    }
+    if (weight != loaded.n) return false;
+    loaded.updateCapacity();
+
+    *this = loaded;
+    return true;
+}
+
+DailyQuantileSketches::DailyQuantileSketches(size_t accuracy) : k(accuracy), first_day(0) {}
+
+int64_t DailyQuantileSketches::dayOf(double timestamp) {
+    return static_cast<int64_t>(std::floor(timestamp / 86400.0));
+}
+
+size_t DailyQuantileSketches::slotFor(int64_t day) {
+    if (days.empty()) {
+        first_day = day;
+        days.assign(1, KllSketch(k));
+        return 0;
+    }
+    if (day < first_day) {
+        days.insert(days.begin(), static_cast<size_t>(first_day - day), KllSketch(k));
+        first_day = day;
+        return 0;
+    }
+    size_t slot = static_cast<size_t>(day - first_day);
+    if (slot >= days.size()) days.resize(slot + 1, KllSketch(k));
+    return slot;
+}
+
+void DailyQuantileSketches::merge(const DailyQuantileSketches& other) {
+    for (size_t i = 0; i < other.days.size(); i++) {
+        if (other.days[i].empty()) continue;
+        size_t slot = slotFor(other.first_day + static_cast<int64_t>(i));
+        days[slot].merge(other.days[i]);
+    }
+}
+
+KllSketch DailyQuantileSketches::combined(double start_time, double end_time) const {
+    KllSketch result(k);
+    int64_t first = dayOf(start_time);
+    int64_t last = static_cast<int64_t>(std::ceil(end_time / 86400.0)) - 1;
+    for (size_t i = 0; i < days.size(); i++) {
+        int64_t day = first_day + static_cast<int64_t>(i);
+        if (day >= first && day <= last) result.merge(days[i]);
+    }
+    return result;
+}
+
+KllSketch DailyQuantileSketches::combined() const {
+    KllSketch result(k);
+    for (const KllSketch& sketch : days) result.merge(sketch);
+    return result;
+}
+
+bool DailyQuantileSketches::save(const std::string& filename) const {
+    std::ofstream out(filename, std::ios::binary);
+    if (!out.is_open()) return false;
+
+    out.write(DAILY_MAGIC, sizeof(DAILY_MAGIC));
+    writeValue(out, SKETCH_VERSION);
+    writeValue(out, static_cast<uint64_t>(days.size()));
+    for (size_t i = 0; i < days.size(); i++) {
+        writeValue(out, first_day + static_cast<int64_t>(i));
+        days[i].write(out);
+    }
+    return static_cast<bool>(out);
+}
+
+bool DailyQuantileSketches::load(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    char magic[8];
+    uint32_t version;
+    uint64_t count;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, DAILY_MAGIC, sizeof(magic)) != 0) return false;
+    if (!readValue(in, version) || version != SKETCH_VERSION) return false;
+    if (!readValue(in, count)) return false;
+
+    // Dibaca ke objek sementara: file rusak tidak mengubah isi saat ini
+    DailyQuantileSketches loaded(k);
+    for (uint64_t i = 0; i < count; i++) {
+        int64_t day;
+        KllSketch sketch;
+        if (!readValue(in, day) || !sketch.read(in)) return false;
+        loaded.days[loaded.slotFor(day)].merge(sketch);
+    }
+    *this = loaded;
+    return true;
+}
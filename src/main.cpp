@@ -1,6 +1,7 @@
 // Enhanced main.cpp dengan Method B
 #include "network_analyzer.h"
 #include "enhanced_network_analyzer.h"
+#include "columnar_store.h"
 #include <iostream>
 #include <string>
 
@@ -30,6 +31,21 @@ void printEnhancedMenu() {
     std::cout << "9. [METHOD B] Perbandingan Lagrange vs RK4" << std::endl;
     std::cout << "10. [METHOD B] Analisis Komprehensif Lengkap" << std::endl;
     std::cout << "11. Export hasil Method B" << std::endl;
+    std::cout << "12. Atur lebar interval agregasi" << std::endl;
+    std::cout << "13. Ringkasan per-flow & per-host" << std::endl;
+    std::cout << "14. Top talker (heavy hitter, memori tetap)" << std::endl;
+    std::cout << "15. Host unik per interval (HyperLogLog)" << std::endl;
+    std::cout << "16. Profil jam-harian dari data nyata" << std::endl;
+    std::cout << "17. Persentil bandwidth (p50/p95/p99 untuk billing)" << std::endl;
+    std::cout << "18. Interpolasi deret penuh (barycentric / spline)" << std::endl;
+    std::cout << "19. Turunan Savitzky-Golay resolusi penuh" << std::endl;
+    std::cout << "20. Anomali online saat ingest (EWMA / MAD)" << std::endl;
+    std::cout << "21. Peak bandwidth berdasarkan prominence" << std::endl;
+    std::cout << "22. Prediksi horizon panjang (Dormand-Prince / RK4, dense output)" << std::endl;
+    std::cout << "23. Ensemble prediksi + pita kepercayaan (p5/p50/p95)" << std::endl;
+    std::cout << "24. Kalibrasi model dinamika ke data (Levenberg-Marquardt)" << std::endl;
+    std::cout << "25. Pilih model dinamika untuk prediksi" << std::endl;
+    std::cout << "26. Statistik rentang waktu multi-resolusi (piramida rollup)" << std::endl;
     std::cout << "0. Keluar" << std::endl;
     std::cout << "Pilihan: ";
 }
@@ -64,6 +80,15 @@ int main() {
     printEnhancedHeader();
     
     EnhancedNetworkAnalyzer analyzer;
+    analyzer.setFlowAggregationEnabled(true);
+    analyzer.setHeavyHitterErrorBound(0.01); // 100 counter per interval
+    analyzer.setDistinctHostPrecision(12);   // 4096 register, galat ~1.6%
+    AnomalyDetectorOptions anomaly_options;
+    anomaly_options.mad_window = 24;         // Konfirmasi robust atas 24 interval terakhir
+    analyzer.setAnomalyDetection(true, anomaly_options);
+    ProfileOptions profile_options;
+    profile_options.by_day_of_week = true;
+    analyzer.setProfileOptions(profile_options);
     bool dataLoaded = false;
     int choice;
     
@@ -74,9 +99,10 @@ int main() {
         switch (choice) {
             case 1: {
                 std::cout << "\nMemuat data mentah dari data/raw/output1.csv..." << std::endl;
-                if (analyzer.loadRawData("data/raw/output1.csv")) {
+                if (analyzer.loadRawDataParallel("data/raw/output1.csv")) {
                     std::cout << "✓ Data mentah berhasil dimuat dan diproses!" << std::endl;
                     analyzer.saveProcessedData("data/processed/network_traffic_timeseries.csv");
+                    analyzer.saveProcessedBinary("data/processed/network_traffic_timeseries.ntcol");
                     dataLoaded = true;
                 } else {
                     std::cout << "✗ Gagal memuat data mentah. Periksa lokasi file." << std::endl;
@@ -86,7 +112,12 @@ int main() {
             
             case 2: {
                 std::cout << "\nMemuat data yang sudah diproses..." << std::endl;
-                if (analyzer.loadProcessedData("data/processed/network_traffic_timeseries.csv")) {
+                // Utamakan file biner kolumnar; CSV sebagai cadangan
+                std::string processed_file = "data/processed/network_traffic_timeseries.ntcol";
+                if (!columnar::isColumnarFile(processed_file)) {
+                    processed_file = "data/processed/network_traffic_timeseries.csv";
+                }
+                if (analyzer.loadProcessedData(processed_file)) {
                     std::cout << "✓ Data terproses berhasil dimuat!" << std::endl;
                     dataLoaded = true;
                 } else {
@@ -193,6 +224,253 @@ int main() {
                 break;
             }
             
+            case 12: {
+                double seconds;
+                std::cout << "\nInterval saat ini: " << analyzer.getIntervalDuration() << " detik" << std::endl;
+                std::cout << "Masukkan lebar interval baru (0.001 - 3600 detik): ";
+                std::cin >> seconds;
+                if (analyzer.setIntervalDuration(seconds)) {
+                    std::cout << "✓ Interval diatur ke " << seconds << " detik. Muat ulang data mentah (pilihan 1)." << std::endl;
+                }
+                break;
+            }
+            
+            case 13: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                std::cout << "\n🌐 RINGKASAN PER-FLOW & PER-HOST" << std::endl;
+                analyzer.printTopFlows(10);
+                if (!analyzer.getFlows().empty()) {
+                    analyzer.exportFlowSeries("data/results/flow_series.csv");
+                }
+                break;
+            }
+            
+            case 14: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                std::cout << "\n🔥 TOP TALKER (HEAVY HITTER)" << std::endl;
+                analyzer.printTopTalkers(10);
+                if (analyzer.getHeavyHitters().intervalCount() > 0) {
+                    analyzer.exportTopTalkers("data/results/top_talkers.csv", 10);
+                }
+                break;
+            }
+            
+            case 15: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                std::cout << "\n🛰️ HOST UNIK PER INTERVAL" << std::endl;
+                analyzer.printDistinctHostSummary();
+                analyzer.exportIntervalSeries("data/results/interval_series.csv");
+                break;
+            }
+            
+            case 16: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                std::cout << "\n🕒 PROFIL JAM-HARIAN" << std::endl;
+                analyzer.printHourlyProfile();
+                analyzer.exportProfile("data/results/hourly_profile.csv");
+                break;
+            }
+            
+            case 17: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                std::cout << "\n💰 PERSENTIL BANDWIDTH" << std::endl;
+                analyzer.printPercentiles();
+                if (!analyzer.getBandwidthQuantiles().empty()) {
+                    analyzer.saveQuantileSketches("data/results/bandwidth_quantiles.kll");
+                }
+                break;
+            }
+            
+            case 18: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                std::cout << "Metode: 1) Linear 2) Lagrange barycentric 3) Spline natural 4) Spline monoton: ";
+                int method_choice;
+                std::cin >> method_choice;
+                InterpolationMethod methods[4] = {InterpolationMethod::Linear, InterpolationMethod::Barycentric,
+                                                  InterpolationMethod::NaturalSpline, InterpolationMethod::MonotoneSpline};
+                if (method_choice < 1 || method_choice > 4) {
+                    std::cout << "❌ Metode tidak valid." << std::endl;
+                    break;
+                }
+                if (analyzer.buildInterpolator(methods[method_choice - 1])) {
+                    const InterpolationEngine& engine = analyzer.getInterpolator();
+                    std::cout << "✅ " << InterpolationEngine::methodName(engine.getMethod()) << " dibangun atas "
+                              << engine.size() << " titik." << std::endl;
+                    // Grid 1/5 lebar interval (deret penuh) atau 6 menit (pola 24 jam)
+                    double step = analyzer.getDataSize() >= 2 ? analyzer.getIntervalDuration() / 5.0 : 0.1;
+                    analyzer.exportInterpolatedSeries("data/results/interpolated_series.csv", step);
+                    
+                    // Volume total dari interpolant: detik -> jam untuk deret penuh
+                    double unit = analyzer.getDataSize() >= 2 ? 3600.0 : 1.0;
+                    QuadratureOptions options;
+                    options.absolute_tolerance = 1e-6 * unit;
+                    QuadratureRule rules[2] = {QuadratureRule::AdaptiveSimpson, QuadratureRule::Romberg};
+                    for (QuadratureRule rule : rules) {
+                        QuadratureResult volume = analyzer.integrateInterpolated(engine.minX(), engine.maxX(), rule, options);
+                        std::cout << "Volume (" << AdaptiveQuadrature::ruleName(rule) << "): "
+                                  << std::fixed << std::setprecision(3) << volume.value / unit << " Mbps×jam"
+                                  << " (galat ~" << std::scientific << std::setprecision(1) << volume.error_estimate / unit
+                                  << std::fixed << ", " << volume.evaluations << " evaluasi"
+                                  << (volume.converged ? "" : ", belum konvergen") << ")" << std::endl;
+                    }
+                }
+                break;
+            }
+            
+            case 19: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                size_t half_window;
+                int order;
+                std::cout << "Setengah lebar jendela (default 3) dan orde polinom (default 2): ";
+                std::cin >> half_window >> order;
+                if (analyzer.analyzeSmoothedGradients(half_window, order)) {
+                    analyzer.exportDerivatives("data/results/derivatives.csv", half_window, order);
+                }
+                break;
+            }
+            
+            case 20: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                analyzer.printStreamingAnomalies();
+                analyzer.exportStreamingAnomalies("data/results/streaming_anomalies.csv");
+                break;
+            }
+            
+            case 21: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                PeakOptions peak_options;
+                double min_gap_hours;
+                std::cout << "Prominence minimum (Mbps) dan jarak minimum antar peak (jam): ";
+                std::cin >> peak_options.min_prominence >> min_gap_hours;
+                peak_options.min_distance = static_cast<size_t>(std::max(1.0, min_gap_hours * 3600.0 / analyzer.getIntervalDuration()));
+                analyzer.printBandwidthPeaks(peak_options);
+                analyzer.exportBandwidthPeaks("data/results/bandwidth_peaks.csv", peak_options);
+                break;
+            }
+            
+            case 22: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                double horizon_hours, step_minutes;
+                int integrator;
+                std::cout << "Horizon prediksi (jam, mis. 168 = 1 minggu) dan resolusi (menit): ";
+                std::cin >> horizon_hours >> step_minutes;
+                std::cout << "Integrator (1 = Dormand-Prince adaptif, 2 = RK4 langkah tetap 0.1 jam): ";
+                std::cin >> integrator;
+                OdeOptions previous = analyzer.getForecastIntegrator();
+                OdeOptions options = previous;
+                options.method = (integrator == 2) ? OdeMethod::ClassicRk4 : OdeMethod::DormandPrince;
+                analyzer.setForecastIntegrator(options);
+                analyzer.exportForecast("data/results/rk4_forecast.csv", horizon_hours, step_minutes / 60.0);
+                analyzer.setForecastIntegrator(previous);
+                break;
+            }
+            
+            case 23: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                EnsembleOptions options;
+                options.floor_value = analyzer.getForecastIntegrator().floor_value;
+                std::cout << "Jumlah anggota ensemble (mis. 10000) dan horizon (jam, mis. 168): ";
+                std::cin >> options.members >> options.horizon_hours;
+                analyzer.exportEnsembleForecast("data/results/ensemble_forecast.csv", options);
+                break;
+            }
+            
+            case 24: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                std::vector<CalibrationResult> results(1, analyzer.calibrateModel());
+                if (results[0].points == 0) {
+                    std::cout << "❌ Kalibrasi tidak dijalankan (butuh model seasonal dan deret terurut)." << std::endl;
+                    break;
+                }
+                std::vector<CalibrationResult> weekly = analyzer.calibrateWeeklyProfile();
+                results.insert(results.end(), weekly.begin(), weekly.end());
+                AnalysisReport::printCalibration(std::cout, results);
+                if (results[0].points > 0 && results[0].converged && results[0].rmse < results[0].initial_rmse) {
+                    analyzer.applyCalibration(results[0]);
+                    std::cout << "✓ Prediksi RK4/ensemble kini memakai parameter hasil kalibrasi pola 24 jam." << std::endl;
+                } else if (results[0].points > 0 && !results[0].converged) {
+                    std::cout << "⚠ Kalibrasi pola 24 jam belum konvergen; parameter model tidak diubah." << std::endl;
+                }
+                analyzer.exportCalibration("data/results/model_calibration.csv", results);
+                break;
+            }
+            
+            case 25: {
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                for (int i = 0; i < TrafficModelRegistry::COUNT; i++) {
+                    TrafficModelKind kind = TrafficModelRegistry::kindAt(i);
+                    std::cout << i + 1 << ". " << TrafficModelRegistry::name(kind)
+                              << (kind == analyzer.getModelRegistry().active ? " (aktif)" : "") << std::endl;
+                }
+                int model_choice;
+                std::cout << "Pilih model (1-" << TrafficModelRegistry::COUNT << "): ";
+                std::cin >> model_choice;
+                if (model_choice < 1 || model_choice > TrafficModelRegistry::COUNT) {
+                    std::cout << "❌ Model tidak valid." << std::endl;
+                    break;
+                }
+                analyzer.selectDynamicsModel(TrafficModelRegistry::kindAt(model_choice - 1));
+                std::cout << "✓ Model aktif: " << TrafficModelRegistry::name(analyzer.getModelRegistry().active) << std::endl;
+                analyzer.predictNext24Hours();
+                break;
+            }
+            
+            case 26: {
+                if (!analyzer.isRollupEnabled()) {
+                    analyzer.setRollupEnabled(true);
+                    std::cout << "✓ Piramida rollup diaktifkan. Muat ulang data mentah (pilihan 1) lalu pilih menu ini lagi." << std::endl;
+                    break;
+                }
+                if (!dataLoaded) {
+                    std::cout << "❌ Silakan muat data terlebih dahulu (pilihan 1 atau 2)." << std::endl;
+                    break;
+                }
+                double start_hours, duration_hours, resolution_seconds;
+                std::cout << "Awal rentang (jam sejak awal jam pertama capture), durasi (jam), resolusi (detik, mis. 300): ";
+                std::cin >> start_hours >> duration_hours >> resolution_seconds;
+                analyzer.printRollupRange(start_hours, duration_hours, resolution_seconds);
+                break;
+            }
+            
             case 0: {
                 std::cout << "\n🎉 Terima kasih telah menggunakan Enhanced Network Analyzer!" << std::endl;
                 std::cout << "Method B (Numerical Differentiation + Runge-Kutta) telah berhasil diimplementasikan." << std::endl;
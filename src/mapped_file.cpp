@@ -0,0 +1,117 @@
+#include "mapped_file.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() : ptr(nullptr), length(0), is_open(false) {
+#ifdef _WIN32
+    file_handle = nullptr;
+    mapping_handle = nullptr;
+#else
+    fd = -1;
+#endif
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    file_handle = file;
+    length = static_cast<size_t>(file_size.QuadPart);
+    is_open = true;
+
+    // File kosong tidak bisa dipetakan, tapi tetap valid (0 byte)
+    if (length == 0) return true;
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        close();
+        return false;
+    }
+    mapping_handle = mapping;
+
+    ptr = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (ptr == nullptr) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() {
+    if (ptr != nullptr) UnmapViewOfFile(ptr);
+    if (mapping_handle != nullptr) CloseHandle(static_cast<HANDLE>(mapping_handle));
+    if (file_handle != nullptr) CloseHandle(static_cast<HANDLE>(file_handle));
+    ptr = nullptr;
+    mapping_handle = nullptr;
+    file_handle = nullptr;
+    length = 0;
+    is_open = false;
+}
+
+#else
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close();
+        return false;
+    }
+
+    length = static_cast<size_t>(st.st_size);
+    is_open = true;
+
+    // File kosong tidak bisa dipetakan, tapi tetap valid (0 byte)
+    if (length == 0) return true;
+
+    void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+        close();
+        return false;
+    }
+    ptr = static_cast<const char*>(mapped);
+
+    // Beri tahu kernel bahwa akses berurutan agar read-ahead agresif
+    madvise(mapped, length, MADV_SEQUENTIAL);
+    return true;
+}
+
+void MappedFile::close() {
+    if (ptr != nullptr) munmap(const_cast<char*>(ptr), length);
+    if (fd >= 0) ::close(fd);
+    ptr = nullptr;
+    fd = -1;
+    length = 0;
+    is_open = false;
+}
+
+#endif
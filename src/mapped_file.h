@@ -0,0 +1,40 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+// File read-only yang dipetakan ke memori (mmap / MapViewOfFile).
+// Isi file bisa dibaca langsung lewat pointer tanpa menyalin ke buffer,
+// sehingga parsing CSV besar dibatasi oleh bandwidth disk, bukan alokasi.
+class MappedFile {
+private:
+    const char* ptr;
+    size_t length;
+    bool is_open;
+#ifdef _WIN32
+    void* file_handle;
+    void* mapping_handle;
+#else
+    int fd;
+#endif
+
+    // Tidak boleh disalin (memiliki resource OS)
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    // Buka dan petakan file; false jika gagal
+    bool open(const std::string& filename);
+    void close();
+
+    bool isOpen() const { return is_open; }
+    const char* data() const { return ptr; }
+    const char* end() const { return ptr + length; }
+    size_t size() const { return length; }
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,393 @@
+#include "model_calibrator.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+// Di bawah jumlah langkah RK4 ini per simulasi, thread per kolom lebih
+// mahal daripada simulasinya sendiri
+const size_t PARALLEL_MIN_STEPS = 20000;
+const double MAX_LAMBDA = 1e12;
+
+template <typename Work>
+void parallelFor(size_t count, unsigned threads, const Work& work) {
+    if (threads <= 1 || count <= 1) {
+        for (size_t item = 0; item < count; item++) work(item);
+        return;
+    }
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads && i < count; i++) {
+        workers.push_back(std::thread([&next, count, &work]() {
+            for (size_t item = next++; item < count; item = next++) work(item);
+        }));
+    }
+    for (auto& worker : workers) worker.join();
+}
+
+unsigned resolveThreads(unsigned threads) {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : threads;
+}
+
+void pack(const TrafficModelParams& params, double initial_value, double* x) {
+    x[0] = params.decay;
+    x[1] = params.amplitude;
+    x[2] = params.phase;
+    x[3] = params.baseline;
+    x[4] = initial_value;
+}
+
+void unpack(const double* x, TrafficModelParams& params, double& initial_value) {
+    params.decay = x[0];
+    params.amplitude = x[1];
+    params.phase = x[2];
+    params.baseline = x[3];
+    initial_value = x[4];
+}
+
+// Tebakan awal dari solusi steady-state model: regresi linear
+// y = c + a*sin(w*tau) + b*cos(w*tau) memberi baseline = c dan
+// amplitude/phase lewat A = R*sqrt(d^2 + w^2), phase = psi + atan2(w, d)
+bool harmonicGuess(const double* times, const double* values, size_t n, bool fit_baseline,
+                   TrafficModelParams& params) {
+    if (n < 3) return false;
+    double w = params.frequency();
+    double normal[3][3] = {{0.0}}, rhs[3] = {0.0};
+    for (size_t i = 0; i < n; i++) {
+        double angle = w * (times[i] - params.time_offset);
+        double basis[3] = {1.0, std::sin(angle), std::cos(angle)};
+        double target = fit_baseline ? values[i] : values[i] - params.baseline;
+        for (int r = 0; r < 3; r++) {
+            rhs[r] += basis[r] * target;
+            for (int c = 0; c < 3; c++) normal[r][c] += basis[r] * basis[c];
+        }
+    }
+    // Tanpa baseline: hanya blok sin/cos (indeks 1..2)
+    int first = fit_baseline ? 0 : 1;
+    for (int pivot = first; pivot < 3; pivot++) {
+        if (std::fabs(normal[pivot][pivot]) < 1e-12) return false;
+        for (int r = pivot + 1; r < 3; r++) {
+            double factor = normal[r][pivot] / normal[pivot][pivot];
+            for (int c = pivot; c < 3; c++) normal[r][c] -= factor * normal[pivot][c];
+            rhs[r] -= factor * rhs[pivot];
+        }
+    }
+    double coef[3] = {0.0};
+    for (int r = 2; r >= first; r--) {
+        double sum = rhs[r];
+        for (int c = r + 1; c < 3; c++) sum -= normal[r][c] * coef[c];
+        coef[r] = sum / normal[r][r];
+    }
+
+    double decay = params.decay > 0.0 ? params.decay : 0.03;
+    double radius = std::sqrt(coef[1] * coef[1] + coef[2] * coef[2]);
+    if (!(radius > 0.0)) return false;
+    params.decay = decay;
+    params.amplitude = radius * std::sqrt(decay * decay + w * w);
+    params.phase = std::atan2(coef[2], coef[1]) + std::atan2(w, decay);
+    if (fit_baseline) params.baseline = coef[0];
+    return true;
+}
+
+// Cholesky in-place untuk sistem k x k kecil (normal equations LM)
+bool solveCholesky(double* a, double* b, size_t k) {
+    for (size_t j = 0; j < k; j++) {
+        double diagonal = a[j * k + j];
+        for (size_t m = 0; m < j; m++) diagonal -= a[j * k + m] * a[j * k + m];
+        if (!(diagonal > 0.0)) return false;
+        a[j * k + j] = std::sqrt(diagonal);
+        for (size_t i = j + 1; i < k; i++) {
+            double sum = a[i * k + j];
+            for (size_t m = 0; m < j; m++) sum -= a[i * k + m] * a[j * k + m];
+            a[i * k + j] = sum / a[j * k + j];
+        }
+    }
+    for (size_t i = 0; i < k; i++) {
+        for (size_t m = 0; m < i; m++) b[i] -= a[i * k + m] * b[m];
+        b[i] /= a[i * k + i];
+    }
+    for (size_t i = k; i-- > 0;) {
+        for (size_t m = i + 1; m < k; m++) b[i] -= a[m * k + i] * b[m];
+        b[i] /= a[i * k + i];
+    }
+    return true;
+}
+
+// Grid RK4 untuk satu set waktu observasi. Frekuensi tidak ikut difit,
+// sehingga sin/cos(w*(t - offset)) di setiap titik setengah langkah
+// dihitung sekali dan dipakai semua simulasi selama fit:
+// amplitude*sin(x + phase) = A*cos(phase)*sin(x) + A*sin(phase)*cos(x).
+class TrajectoryGrid {
+private:
+    std::vector<size_t> steps;  // Sub-langkah per interval observasi
+    std::vector<double> widths; // Lebar sub-langkah per interval
+    std::vector<double> sines, cosines;
+    size_t n;
+
+public:
+    TrajectoryGrid(const TrafficModelParams& model, const double* times, size_t count, double step_hours)
+        : steps(count > 0 ? count - 1 : 0), widths(steps.size()), n(count) {
+        size_t total = 0;
+        for (size_t i = 1; i < n; i++) {
+            double span = times[i] - times[i - 1];
+            size_t m = 0;
+            if (span > 0.0) {
+                // Sub-langkah seragam sehingga setiap observasi tepat di grid
+                m = static_cast<size_t>(std::ceil(span / step_hours - 1e-9));
+                if (m == 0) m = 1;
+                widths[i - 1] = span / static_cast<double>(m);
+            }
+            steps[i - 1] = m;
+            total += m;
+        }
+        sines.resize(2 * total + 1);
+        cosines.resize(2 * total + 1);
+        double w = model.frequency();
+        size_t g = 0;
+        if (n > 0) {
+            sines[0] = std::sin(w * (times[0] - model.time_offset));
+            cosines[0] = std::cos(w * (times[0] - model.time_offset));
+        }
+        for (size_t i = 1; i < n; i++) {
+            for (size_t s = 0; s < steps[i - 1]; s++, g++) {
+                for (size_t half = 1; half <= 2; half++) {
+                    double t = times[i - 1] + widths[i - 1] * (static_cast<double>(s) + 0.5 * half);
+                    sines[2 * g + half] = std::sin(w * (t - model.time_offset));
+                    cosines[2 * g + half] = std::cos(w * (t - model.time_offset));
+                }
+            }
+        }
+    }
+
+    size_t totalSteps() const { return (sines.size() - 1) / 2; }
+
+    void simulate(const TrafficModelParams& params, double initial_value, double floor_value, double* results) const {
+        if (n == 0) return;
+        double d = params.decay, level = params.decay * params.baseline;
+        double a = params.amplitude * std::cos(params.phase);
+        double b = params.amplitude * std::sin(params.phase);
+        double y = initial_value;
+        results[0] = y;
+        size_t g = 0;
+        for (size_t i = 1; i < n; i++) {
+            double h = widths[i - 1];
+            for (size_t s = 0; s < steps[i - 1]; s++, g++) {
+                const double* sn = &sines[2 * g];
+                const double* cs = &cosines[2 * g];
+                double forcing_mid = level + a * sn[1] + b * cs[1];
+                double k1 = -d * y + (level + a * sn[0] + b * cs[0]);
+                double k2 = -d * (y + h * k1 / 2) + forcing_mid;
+                double k3 = -d * (y + h * k2 / 2) + forcing_mid;
+                double k4 = -d * (y + h * k3) + (level + a * sn[2] + b * cs[2]);
+                y += h * (k1 + 2 * k2 + 2 * k3 + k4) / 6.0;
+                if (y < floor_value) y = floor_value;
+            }
+            results[i] = y;
+        }
+    }
+};
+
+struct Problem {
+    const double* values;
+    size_t n;
+    TrafficModelParams base;  // period/time_offset tetap
+    double floor_value;
+    const TrajectoryGrid& grid;
+
+    // residual = simulasi(x) - observasi; mengembalikan 0.5 * sum(r^2)
+    double residuals(const double* x, double* r) const {
+        TrafficModelParams params = base;
+        double initial_value;
+        unpack(x, params, initial_value);
+        grid.simulate(params, initial_value, floor_value, r);
+        double cost = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            r[i] -= values[i];
+            cost += r[i] * r[i];
+        }
+        return 0.5 * cost;
+    }
+};
+
+} // namespace
+
+bool ModelCalibrator::simulate(const TrafficModelParams& params, double initial_value, const double* times, size_t n,
+                               const CalibrationOptions& options, double* results) {
+    if (!(options.step_hours > 0.0)) return false;
+    TrajectoryGrid grid(params, times, n, options.step_hours);
+    grid.simulate(params, initial_value, options.floor_value, results);
+    return true;
+}
+
+CalibrationResult ModelCalibrator::fit(const double* times, const double* values, size_t n,
+                                       const TrafficModelParams& guess, const CalibrationOptions& options) {
+    CalibrationResult result;
+    result.params = guess;
+    if (n < 2 || !(options.step_hours > 0.0)) return result; // points = 0: tidak ada fit
+    result.points = n;
+
+    TrajectoryGrid grid(guess, times, n, options.step_hours);
+    Problem problem = {values, n, guess, options.floor_value, grid};
+    std::vector<double> r(n), trial_r(n);
+
+    double x[PARAMETERS];
+    pack(guess, values[0], x);
+    double cost = problem.residuals(x, r.data());
+    result.initial_rmse = std::sqrt(2.0 * cost / n);
+    result.trajectory_evaluations = 1;
+
+    if (options.harmonic_guess) {
+        TrafficModelParams harmonic = guess;
+        if (harmonicGuess(times, values, n, options.fit_baseline, harmonic)) {
+            double candidate[PARAMETERS];
+            pack(harmonic, values[0], candidate);
+            double candidate_cost = problem.residuals(candidate, trial_r.data());
+            result.trajectory_evaluations++;
+            if (candidate_cost < cost) {
+                std::copy(candidate, candidate + PARAMETERS, x);
+                cost = candidate_cost;
+                r.swap(trial_r);
+            }
+        }
+    }
+
+    // Parameter aktif: baseline bisa dikunci
+    size_t active[PARAMETERS];
+    size_t k = 0;
+    for (size_t j = 0; j < PARAMETERS; j++) {
+        if (j == 3 && !options.fit_baseline) continue;
+        active[k++] = j;
+    }
+
+    unsigned threads = grid.totalSteps() >= PARALLEL_MIN_STEPS ? resolveThreads(options.threads) : 1;
+
+    // Henti absolut: RMSE <= tolerance x skala data (RMS observasi). Uji
+    // relatif di bawah tidak pernah terpenuhi saat cost -> 0 karena
+    // penurunan relatifnya tetap besar pada fit yang hampir persis.
+    double square_sum = 0.0;
+    for (size_t i = 0; i < n; i++) square_sum += values[i] * values[i];
+    double rmse_floor = options.tolerance * std::sqrt(square_sum / n);
+    double stop_cost = 0.5 * n * rmse_floor * rmse_floor;
+
+    std::vector<double> jacobian(k * n); // Kolom-mayor: jacobian[c * n + i]
+    double lambda = options.initial_lambda;
+    for (result.iterations = 0; result.iterations < options.max_iterations; result.iterations++) {
+        if (cost <= stop_cost) {
+            result.converged = true;
+            break;
+        }
+
+        // Kolom Jacobian dengan beda maju, satu simulasi per kolom
+        parallelFor(k, threads, [&](size_t c) {
+            double shifted[PARAMETERS];
+            std::copy(x, x + PARAMETERS, shifted);
+            size_t j = active[c];
+            double delta = 1.4901161193847656e-08 * std::max(std::fabs(x[j]), 1.0);
+            shifted[j] += delta;
+            double* column = &jacobian[c * n];
+            problem.residuals(shifted, column);
+            for (size_t i = 0; i < n; i++) column[i] = (column[i] - r[i]) / delta;
+        });
+        result.trajectory_evaluations += k;
+
+        double normal[PARAMETERS * PARAMETERS], gradient[PARAMETERS];
+        double gradient_norm = 0.0;
+        for (size_t a = 0; a < k; a++) {
+            const double* ja = &jacobian[a * n];
+            double g = 0.0;
+            for (size_t i = 0; i < n; i++) g += ja[i] * r[i];
+            gradient[a] = g;
+            gradient_norm = std::max(gradient_norm, std::fabs(g));
+            for (size_t b = 0; b <= a; b++) {
+                const double* jb = &jacobian[b * n];
+                double sum = 0.0;
+                for (size_t i = 0; i < n; i++) sum += ja[i] * jb[i];
+                normal[a * k + b] = normal[b * k + a] = sum;
+            }
+        }
+        if (gradient_norm <= options.tolerance * std::max(cost, 1e-300)) {
+            result.converged = true;
+            break;
+        }
+
+        // Perkecil langkah (lambda naik) sampai cost turun
+        bool accepted = false;
+        while (!accepted && lambda < MAX_LAMBDA) {
+            double damped[PARAMETERS * PARAMETERS], step[PARAMETERS];
+            std::copy(normal, normal + k * k, damped);
+            for (size_t a = 0; a < k; a++) {
+                damped[a * k + a] += lambda * std::max(normal[a * k + a], 1e-12);
+                step[a] = -gradient[a];
+            }
+            if (!solveCholesky(damped, step, k)) {
+                lambda *= 4.0;
+                continue;
+            }
+
+            double trial[PARAMETERS];
+            std::copy(x, x + PARAMETERS, trial);
+            double step_norm = 0.0, x_norm = 0.0;
+            for (size_t a = 0; a < k; a++) {
+                trial[active[a]] += step[a];
+                step_norm += step[a] * step[a];
+                x_norm += x[active[a]] * x[active[a]];
+            }
+            if (trial[0] < 0.0) trial[0] = 0.0; // decay negatif membuat model meledak
+
+            double trial_cost = problem.residuals(trial, trial_r.data());
+            result.trajectory_evaluations++;
+            if (trial_cost < cost) {
+                accepted = true;
+                double reduction = (cost - trial_cost) / std::max(cost, 1e-300);
+                std::copy(trial, trial + PARAMETERS, x);
+                cost = trial_cost;
+                r.swap(trial_r);
+                lambda = std::max(lambda / 3.0, 1e-12);
+                if (cost <= stop_cost || reduction < options.tolerance ||
+                    std::sqrt(step_norm) < options.tolerance * (std::sqrt(x_norm) + options.tolerance)) {
+                    result.converged = true;
+                }
+            } else {
+                lambda *= 4.0;
+            }
+        }
+        if (!accepted) {
+            // lambda mencapai batas tanpa penurunan cost: macet, bukan
+            // konvergen (gradien belum memenuhi toleransi)
+            result.converged = false;
+            break;
+        }
+        if (result.converged) {
+            result.iterations++;
+            break;
+        }
+    }
+
+    // Bentuk kanonik: amplitude >= 0, phase di (-pi, pi]
+    if (x[1] < 0.0) {
+        x[1] = -x[1];
+        x[2] += M_PI;
+    }
+    x[2] = std::remainder(x[2], 2 * M_PI);
+    unpack(x, result.params, result.initial_value);
+    result.rmse = std::sqrt(2.0 * cost / n);
+    return result;
+}
+
+std::vector<CalibrationResult> ModelCalibrator::fitBatch(const std::vector<CalibrationSeries>& series,
+                                                         const TrafficModelParams& guess,
+                                                         const CalibrationOptions& options) {
+    std::vector<CalibrationResult> results(series.size());
+    CalibrationOptions single = options;
+    single.threads = 1; // Paralel antar deret, bukan antar kolom
+    parallelFor(series.size(), resolveThreads(options.threads), [&](size_t s) {
+        const CalibrationSeries& item = series[s];
+        size_t n = std::min(item.times.size(), item.values.size());
+        results[s] = fit(item.times.data(), item.values.data(), n, guess, single);
+        results[s].label = item.label;
+    });
+    return results;
+}
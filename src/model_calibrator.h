@@ -0,0 +1,55 @@
+#ifndef MODEL_CALIBRATOR_H
+#define MODEL_CALIBRATOR_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "traffic_model.h"
+#include "analysis_results.h"
+
+struct CalibrationOptions {
+    double step_hours;          // Langkah RK4 maksimum di antara observasi
+    double floor_value;         // Batas bawah trajektori (bandwidth tidak negatif)
+    size_t max_iterations;
+    double initial_lambda;      // Redaman Levenberg-Marquardt awal
+    double tolerance;           // Berhenti jika penurunan cost / langkah relatif < tolerance,
+                                // atau RMSE < tolerance x RMS data (fit hampir persis)
+    bool fit_baseline;
+    bool harmonic_guess;        // Tebakan awal dari regresi harmonik linear
+    unsigned threads;           // 0 = semua core (kolom Jacobian / deret batch)
+
+    CalibrationOptions()
+        : step_hours(0.1), floor_value(0.0), max_iterations(100), initial_lambda(1e-3), tolerance(1e-8),
+          fit_baseline(true), harmonic_guess(true), threads(0) {}
+};
+
+struct CalibrationSeries {
+    std::string label;
+    std::vector<double> times;  // Jam, naik
+    std::vector<double> values; // Mbps
+};
+
+// Kalibrasi decay/amplitude/phase/baseline (dan B(t0)) dengan
+// Levenberg-Marquardt atas trajektori RK4: residual = simulasi - observasi
+// pada setiap waktu observasi, Jacobian dengan beda maju. Setiap kolom
+// Jacobian adalah satu simulasi independen sehingga dihitung paralel
+// untuk deret panjang; fitBatch() memparalelkan antar deret (setiap fit
+// satu thread) untuk ribuan link. Periode dan time_offset tetap.
+class ModelCalibrator {
+public:
+    static const size_t PARAMETERS = 5; // decay, amplitude, phase, baseline, B(t0)
+
+    static CalibrationResult fit(const double* times, const double* values, size_t n,
+                                 const TrafficModelParams& guess,
+                                 const CalibrationOptions& options = CalibrationOptions());
+    static std::vector<CalibrationResult> fitBatch(const std::vector<CalibrationSeries>& series,
+                                                   const TrafficModelParams& guess,
+                                                   const CalibrationOptions& options = CalibrationOptions());
+
+    // Trajektori RK4 dari (times[0], initial_value), dibaca di setiap times[i];
+    // false (results tidak diubah) jika options.step_hours tidak positif
+    static bool simulate(const TrafficModelParams& params, double initial_value, const double* times, size_t n,
+                         const CalibrationOptions& options, double* results);
+};
+
+#endif // MODEL_CALIBRATOR_H
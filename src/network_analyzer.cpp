@@ -1,6 +1,11 @@
 #include "network_analyzer.h"
-#include <map>
-#include <random>
+#include "mapped_file.h"
+#include "csv_fast_parse.h"
+#include "ingest_pipeline.h"
+#include "columnar_store.h"
+#include <chrono>
+#include <thread>
+#include <limits>
 
 // Definisikan M_PI jika tidak tersedia
 #ifndef M_PI
@@ -10,15 +15,238 @@
 // Alternatif: gunakan const double
 const double PI = 3.14159265358979323846;
 
-NetworkAnalyzer::NetworkAnalyzer() {
+NetworkAnalyzer::NetworkAnalyzer()
+    : time_hours_sorted(true), integral_index_valid(false), series_revision(0), last_ingest_mbps(0.0), interval_seconds(300.0), rollup_enabled(false),
+      flows_enabled(false), flow_origin(0.0), heavy_hitter_capacity(0),
+      distinct_precision(0), quantile_accuracy(KllSketch::DEFAULT_K), anomaly_detection_enabled(false) {
     // Inisialisasi struktur data kosong
 }
 
+bool NetworkAnalyzer::setIntervalDuration(double seconds) {
+    if (!TrafficAggregate::isValidInterval(seconds)) {
+        std::cerr << "Error: Interval harus antara " << TrafficAggregate::MIN_INTERVAL
+                  << " dan " << TrafficAggregate::MAX_INTERVAL << " detik." << std::endl;
+        return false;
+    }
+    interval_seconds = seconds;
+    return true;
+}
+
+bool NetworkAnalyzer::setQuantileAccuracy(size_t k) {
+    if (!KllSketch::isValidK(k)) {
+        std::cerr << "Error: Parameter k sketch kuantil harus antara " << KllSketch::MIN_K
+                  << " dan " << KllSketch::MAX_K << "." << std::endl;
+        return false;
+    }
+    quantile_accuracy = k;
+    return true;
+}
+
+bool NetworkAnalyzer::setDistinctHostPrecision(int bits) {
+    if (bits != 0 && !HyperLogLog::isValidPrecision(bits)) {
+        std::cerr << "Error: Presisi HyperLogLog harus 0 atau antara " << HyperLogLog::MIN_PRECISION
+                  << " dan " << HyperLogLog::MAX_PRECISION << " bit." << std::endl;
+        return false;
+    }
+    distinct_precision = bits;
+    return true;
+}
+
 double NetworkAnalyzer::convertToMbps(double bytes, double time_interval) {
     // Konversi bytes ke Mbps: (bytes * 8 bit/byte) / (waktu_detik * 1e6)
     return (bytes * 8.0) / (time_interval * 1e6);
 }
 
+// Timestamp pada posisi indeks pecahan (tepi lebar peak); interval kosong
+// tidak ada di 'data' sehingga jarak antar titik tidak selalu seragam
+static double timestampAt(const std::vector<TrafficData>& data, double position) {
+    size_t index = static_cast<size_t>(position);
+    if (index + 1 >= data.size()) return data.back().timestamp;
+    double fraction = position - static_cast<double>(index);
+    return data[index].timestamp + fraction * (data[index + 1].timestamp - data[index].timestamp);
+}
+
+std::vector<Peak> NetworkAnalyzer::findBandwidthPeaks(const PeakOptions& options) const {
+    std::vector<double> values(data.size());
+    for (size_t i = 0; i < data.size(); i++) values[i] = data[i].bandwidth_mbps;
+    return PeakFinder::find(values.data(), values.size(), options);
+}
+
+void NetworkAnalyzer::printBandwidthPeaks(const PeakOptions& options, size_t limit) {
+    if (data.size() < 3) {
+        std::cout << "Tidak ada deret interval. Muat data mentah terlebih dahulu." << std::endl;
+        return;
+    }
+    
+    std::vector<Peak> peaks = findBandwidthPeaks(options);
+    std::cout << "\n=== PEAK BANDWIDTH (PROMINENCE >= " << std::fixed << std::setprecision(3)
+              << options.min_prominence << " Mbps, jarak >= " << options.min_distance << " interval) ===" << std::endl;
+    std::cout << peaks.size() << " peak dari " << data.size() << " interval." << std::endl;
+    
+    // Urutkan menurut prominence agar peak paling menonjol tampil dulu
+    std::vector<size_t> order(peaks.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&peaks](size_t a, size_t b) {
+        return peaks[a].prominence > peaks[b].prominence;
+    });
+    
+    std::cout << "Waktu\t\tBandwidth\tProminence\tLebar (jam)" << std::endl;
+    for (size_t rank = 0; rank < order.size() && rank < limit; rank++) {
+        const Peak& peak = peaks[order[rank]];
+        std::cout << std::setprecision(0) << data[peak.index].timestamp << "\t"
+                  << std::setprecision(3) << peak.height << "\t\t" << peak.prominence << "\t\t"
+                  << std::setprecision(2)
+                  << (timestampAt(data, peak.right_edge) - timestampAt(data, peak.left_edge)) / 3600.0 << "\n";
+    }
+    std::cout.flush();
+}
+
+void NetworkAnalyzer::exportBandwidthPeaks(const std::string& filename, const PeakOptions& options) {
+    std::vector<Peak> peaks = findBandwidthPeaks(options);
+    std::ofstream outFile(filename);
+    
+    outFile << "Timestamp,Bandwidth_Mbps,Prominence_Mbps,Width_Seconds,Left_Base,Right_Base\n";
+    for (const Peak& peak : peaks) {
+        outFile << std::fixed << std::setprecision(3) << data[peak.index].timestamp << ","
+                << std::setprecision(6) << peak.height << "," << peak.prominence << ","
+                << std::setprecision(1) << timestampAt(data, peak.right_edge) - timestampAt(data, peak.left_edge) << ","
+                << std::setprecision(3) << data[peak.left_base].timestamp << ","
+                << data[peak.right_base].timestamp << "\n";
+    }
+    
+    outFile.close();
+    std::cout << "Peak bandwidth diekspor ke " << filename << std::endl;
+}
+
+void NetworkAnalyzer::setAnomalyDetection(bool enabled, const AnomalyDetectorOptions& options) {
+    anomaly_detection_enabled = enabled;
+    anomaly_options = options;
+    anomaly_detector = StreamingAnomalyDetector(options);
+}
+
+const char* NetworkAnalyzer::linkMetricName(uint32_t metric) {
+    switch (metric) {
+        case METRIC_BANDWIDTH: return "bandwidth_mbps";
+        case METRIC_PACKETS: return "packets";
+        case METRIC_DISTINCT_SOURCES: return "distinct_sources";
+        case METRIC_DISTINCT_DESTINATIONS: return "distinct_destinations";
+    }
+    return "-";
+}
+
+void NetworkAnalyzer::printStreamingAnomalies(size_t limit) {
+    if (!anomaly_detection_enabled) {
+        std::cout << "Detektor anomali nonaktif. Aktifkan lalu muat ulang data mentah." << std::endl;
+        return;
+    }
+    
+    const std::vector<AnomalyEvent>& events = anomaly_detector.getEvents();
+    const AnomalyDetectorOptions& options = anomaly_detector.getOptions();
+    std::cout << "\n=== ANOMALI ONLINE (EWMA alpha " << std::fixed << std::setprecision(2) << options.alpha
+              << ", |z| > " << std::setprecision(1) << options.z_threshold;
+    if (options.mad_window > 0) std::cout << ", MAD " << options.mad_window << " interval";
+    std::cout << ") ===" << std::endl;
+    std::cout << events.size() << " dari " << anomaly_detector.sampleCount() << " sampel ditandai." << std::endl;
+    
+    std::cout << "Interval\t\tMetrik\t\t\tNilai\t\tEkspektasi\tZ" << std::endl;
+    for (size_t i = 0; i < events.size() && i < limit; i++) {
+        const AnomalyEvent& event = events[i];
+        std::cout << std::setprecision(0) << flow_origin + event.interval_id * interval_seconds << "\t"
+                  << std::left << std::setw(24) << linkMetricName(event.series) << std::right
+                  << std::setprecision(3) << event.value << "\t\t" << event.expected << "\t\t"
+                  << std::setprecision(1) << event.z_score << "\n";
+    }
+    if (events.size() > limit) std::cout << "... " << events.size() - limit << " lainnya\n";
+    std::cout.flush();
+}
+
+void NetworkAnalyzer::exportStreamingAnomalies(const std::string& filename) {
+    std::ofstream outFile(filename);
+    
+    outFile << "Interval_Start,Metric,Value,Expected,Z_Score,Robust_Score\n";
+    for (const AnomalyEvent& event : anomaly_detector.getEvents()) {
+        outFile << std::fixed << std::setprecision(3) << flow_origin + event.interval_id * interval_seconds << ","
+                << linkMetricName(event.series) << "," << std::setprecision(6) << event.value << ","
+                << event.expected << "," << event.z_score << "," << event.robust_score << "\n";
+    }
+    
+    outFile.close();
+    std::cout << "Anomali online diekspor ke " << filename << std::endl;
+}
+
+void NetworkAnalyzer::printRollupRange(double start_hours, double duration_hours, double resolution_seconds) {
+    if (rollup.empty()) {
+        std::cout << "Piramida rollup kosong. Aktifkan rollup lalu muat ulang data mentah." << std::endl;
+        return;
+    }
+    if (duration_hours <= 0.0 || resolution_seconds <= 0.0) {
+        std::cerr << "Error: Durasi dan resolusi harus positif." << std::endl;
+        return;
+    }
+    
+    // Jangkar di awal jam pertama capture agar batas rentang sejajar dengan
+    // bucket level kasar; rentang yang tidak sejajar jatuh ke level 1 detik
+    double start = std::floor(rollup.startTime() / 3600.0) * 3600.0 + start_hours * 3600.0;
+    double end = start + duration_hours * 3600.0;
+    RollupRangeStats stats = rollup.statistics(start, end, resolution_seconds);
+    
+    std::cout << "\n=== RENTANG " << std::fixed << std::setprecision(0) << start << " - " << end
+              << " (level " << stats.resolution << " detik, " << stats.samples << " bucket) ===" << std::endl;
+    if (stats.samples == 0) {
+        std::cout << "Tidak ada bucket dalam rentang ini." << std::endl;
+        return;
+    }
+    std::cout << std::setprecision(6)
+              << "Rata-rata : " << stats.mean_mbps << " Mbps" << std::endl
+              << "Min / Max : " << stats.min_mbps << " / " << stats.max_mbps << " Mbps" << std::endl
+              << "Paket     : " << stats.total_packets << " (" << stats.total_bytes << " byte)" << std::endl
+              << "Volume    : " << rollup.simpsonIntegration(start, end, resolution_seconds) << " Mbps x jam (Simpson)" << std::endl
+              << "Nilai tengah rentang: " << rollup.interpolate(0.5 * (start + end), resolution_seconds) << " Mbps" << std::endl;
+}
+
+IngestOptions NetworkAnalyzer::makeIngestOptions() const {
+    IngestOptions options;
+    options.interval_seconds = interval_seconds;
+    options.build_rollup = rollup_enabled;
+    options.aggregate_flows = flows_enabled;
+    options.heavy_hitter_capacity = heavy_hitter_capacity;
+    options.distinct_precision = distinct_precision;
+    return options;
+}
+
+void NetworkAnalyzer::finishIngest(const IngestPipeline& pipeline) {
+    if (!pipeline.hasPackets()) return;
+
+    int64_t outliers = pipeline.getLinkAggregate().outlierPackets();
+    if (outliers > 0) {
+        std::cerr << "Peringatan: " << outliers << " paket dengan timestamp di luar rentang "
+                  << pipeline.getLinkAggregate().maxSpan() << " interval diabaikan." << std::endl;
+    }
+
+    flows = pipeline.getFlows();
+    flow_origin = pipeline.getLinkAggregate().getOrigin();
+    heavy_hitters = pipeline.getHeavyHitters();
+    distinct_hosts = pipeline.getDistinctHosts();
+    series_interpolator = InterpolationEngine(); // Deret berubah: bangun ulang bila diperlukan
+    
+    // Konversi interval menjadi deret bandwidth (+ estimasi host unik)
+    buildTrafficSeries(pipeline.getLinkAggregate());
+    
+    if (pipeline.getOptions().build_rollup) {
+        rollup.build(pipeline.getRollupBase());
+        if (pipeline.getRollupBase().outlierPackets() > 0) {
+            std::cerr << "Peringatan: " << pipeline.getRollupBase().outlierPackets()
+                      << " paket di luar rentang " << RollupPyramid::MAX_BASE_SPAN / 86400
+                      << " hari tidak masuk piramida rollup." << std::endl;
+        }
+    } else {
+        rollup.clear();
+    }
+    
+    // Buat pola 24 jam untuk analisis
+    generateHourlyPattern();
+}
+
 bool NetworkAnalyzer::loadRawData(const std::string& filename) {
     std::ifstream file(filename);
     if (!file.is_open()) {
@@ -29,115 +257,254 @@ bool NetworkAnalyzer::loadRawData(const std::string& filename) {
     std::string line;
     std::getline(file, line); // Lewati header
     
-    std::vector<std::pair<double, int>> raw_packets; // timestamp, length
+    // Parsing dan agregasi dilakukan dalam satu pass streaming: memori
+    // sebanding dengan jumlah interval, bukan jumlah paket
+    IngestPipeline pipeline(makeIngestOptions());
     
     while (std::getline(file, line)) {
-        std::stringstream ss(line);
-        std::string item;
-        
         // Parse CSV: Timestamp,Source IP,Destination IP,Protocol,Length
-        std::getline(ss, item, ',');
-        double timestamp = std::stod(item);
-        
-        // Lewati source IP, dest IP, protocol
-        std::getline(ss, item, ','); // Source IP
-        std::getline(ss, item, ','); // Dest IP  
-        std::getline(ss, item, ','); // Protocol
-        
-        std::getline(ss, item, ',');
-        if (!item.empty()) {
-            int length = std::stoi(item);
-            raw_packets.push_back({timestamp, length});
+        const char* p = line.data();
+        PacketRecord record;
+        if (pipeline.parse(p, p + line.size(), record)) {
+            pipeline.add(record);
         }
     }
     
     file.close();
-    std::cout << "Memuat " << raw_packets.size() << " paket dari data mentah." << std::endl;
-    
-    // Agregasi paket menjadi interval waktu
-    aggregateData(raw_packets);
-    
-    // Buat pola 24 jam untuk analisis
-    generateHourlyPattern();
+    std::cout << "Memuat " << pipeline.getLinkAggregate().totalPackets() << " paket dari data mentah." << std::endl;
     
+    finishIngest(pipeline);
     return true;
 }
 
-void NetworkAnalyzer::aggregateData(const std::vector<std::pair<double, int>>& raw_packets) {
-    if (raw_packets.empty()) return;
-    
-    // Cari rentang waktu
-    double min_time = raw_packets[0].first;
-    double max_time = raw_packets.back().first;
-    double duration = max_time - min_time;
-    
-    // Buat interval 5 menit
-    const double interval_duration = 300.0; // 5 menit dalam detik
-    std::map<int, std::pair<int, int>> intervals; // interval_id -> (total_bytes, packet_count)
-    
-    for (const auto& packet : raw_packets) {
-        int interval_id = static_cast<int>((packet.first - min_time) / interval_duration);
-        intervals[interval_id].first += packet.second;  // total bytes
-        intervals[interval_id].second += 1;             // packet count
+bool NetworkAnalyzer::loadRawDataMapped(const std::string& filename) {
+    auto start_clock = std::chrono::steady_clock::now();
+
+    MappedFile file;
+    if (!file.open(filename)) {
+        std::cerr << "Error: Tidak dapat membuka file " << filename << std::endl;
+        return false;
     }
+
+    const char* p = file.data();
+    const char* end = file.end();
+    if (p != nullptr) csvparse::skipLine(p, end); // Lewati header
+
+    // Agregasi langsung saat parsing, tanpa menyimpan paket mentah
+    IngestPipeline pipeline(makeIngestOptions());
+
+    while (p < end) {
+        PacketRecord record;
+        if (pipeline.parse(p, end, record)) {
+            pipeline.add(record);
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_clock).count();
+    double megabytes = file.size() / 1e6;
+    last_ingest_mbps = seconds > 0 ? megabytes / seconds : 0.0;
+
+    std::cout << "Memuat " << pipeline.getLinkAggregate().totalPackets() << " paket dari data mentah (mmap)." << std::endl;
+    std::cout << "Throughput ingest: " << std::fixed << std::setprecision(1)
+              << last_ingest_mbps << " MB/s (" << megabytes << " MB dalam "
+              << std::setprecision(3) << seconds << " detik)" << std::endl;
+
+    finishIngest(pipeline);
+    return true;
+}
+
+bool NetworkAnalyzer::loadRawDataParallel(const std::string& filename, unsigned num_threads) {
+    auto start_clock = std::chrono::steady_clock::now();
+
+    MappedFile file;
+    if (!file.open(filename)) {
+        std::cerr << "Error: Tidak dapat membuka file " << filename << std::endl;
+        return false;
+    }
+
+    const char* begin = file.data();
+    const char* end = file.end();
+    if (begin != nullptr) csvparse::skipLine(begin, end); // Lewati header
+
+    // Origin interval = timestamp paket pertama (sama seperti loadRawData)
+    PacketRecord first_packet;
+    bool found_origin = false;
+    for (const char* p = begin; p < end && !found_origin;) {
+        found_origin = IngestPipeline::parseLine(p, end, first_packet);
+    }
+    if (!found_origin) {
+        std::cerr << "Error: Tidak ada paket valid di " << filename << std::endl;
+        return false;
+    }
+
+    if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+    if (num_threads == 0) num_threads = 1;
+    // Hindari potongan terlalu kecil (< 1 MB) yang hanya menambah overhead thread
+    size_t total_bytes = static_cast<size_t>(end - begin);
+    size_t max_threads = total_bytes / (1 << 20) + 1;
+    if (num_threads > max_threads) num_threads = static_cast<unsigned>(max_threads);
+
+    // Bagi buffer menjadi rentang byte yang berakhir tepat setelah '\n'
+    std::vector<const char*> bounds(num_threads + 1);
+    bounds[0] = begin;
+    bounds[num_threads] = end;
+    for (unsigned i = 1; i < num_threads; i++) {
+        const char* cut = begin + total_bytes / num_threads * i;
+        if (cut < bounds[i - 1]) cut = bounds[i - 1];
+        csvparse::skipLine(cut, end);
+        bounds[i] = cut;
+    }
+
+    // Setiap thread mem-parse dan mengagregasi rentangnya sendiri
+    IngestPipeline prototype(makeIngestOptions());
+    prototype.setOrigin(first_packet.timestamp);
+    std::vector<IngestPipeline> partials(num_threads, prototype);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < num_threads; i++) {
+        workers.push_back(std::thread([&bounds, &partials, i]() {
+            const char* p = bounds[i];
+            const char* range_end = bounds[i + 1];
+            IngestPipeline& partial = partials[i];
+            while (p < range_end) {
+                PacketRecord record;
+                if (partial.parse(p, range_end, record)) {
+                    partial.add(record);
+                }
+            }
+        }));
+    }
+    for (auto& worker : workers) worker.join();
+
+    // Gabungkan agregat parsial
+    IngestPipeline& merged = partials[0];
+    for (unsigned i = 1; i < num_threads; i++) {
+        merged.merge(partials[i]);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_clock).count();
+    double megabytes = file.size() / 1e6;
+    last_ingest_mbps = seconds > 0 ? megabytes / seconds : 0.0;
+
+    std::cout << "Memuat " << merged.getLinkAggregate().totalPackets() << " paket dari data mentah ("
+              << num_threads << " thread)." << std::endl;
+    std::cout << "Throughput ingest: " << std::fixed << std::setprecision(1)
+              << last_ingest_mbps << " MB/s (" << megabytes << " MB dalam "
+              << std::setprecision(3) << seconds << " detik)" << std::endl;
+
+    finishIngest(merged);
+    return true;
+}
+
+void NetworkAnalyzer::buildTrafficSeries(const TrafficAggregate& aggregate) {
+    double interval_duration = aggregate.getIntervalDuration();
     
-    // Konversi ke pengukuran bandwidth
+    // Konversi ke pengukuran bandwidth (interval tanpa paket dilewati)
     data.clear();
-    for (const auto& interval_pair : intervals) {
+    bandwidth_quantiles = DailyQuantileSketches(quantile_accuracy);
+    anomaly_detector = StreamingAnomalyDetector(anomaly_options);
+    for (size_t i = 0; i < aggregate.bucketCount(); i++) {
+        // Sketch kuantil menerima setiap interval, termasuk yang kosong
+        // (0 Mbps), sesuai cara sampel billing persentil ke-95 dihitung
+        double mbps = convertToMbps(static_cast<double>(aggregate.bucketBytes(i)), interval_duration);
+        bandwidth_quantiles.add(aggregate.bucketStart(i), mbps);
+        int64_t interval_id = aggregate.bucketIntervalId(i);
+        double sources = distinct_hosts.estimate(interval_id, true);
+        double destinations = distinct_hosts.estimate(interval_id, false);
+        
+        // Detektor anomali juga melihat interval kosong (link mati = anomali)
+        if (anomaly_detection_enabled) {
+            anomaly_detector.update(METRIC_BANDWIDTH, interval_id, mbps);
+            anomaly_detector.update(METRIC_PACKETS, interval_id, static_cast<double>(aggregate.bucketPackets(i)));
+            if (distinct_hosts.enabled()) {
+                anomaly_detector.update(METRIC_DISTINCT_SOURCES, interval_id, sources);
+                anomaly_detector.update(METRIC_DISTINCT_DESTINATIONS, interval_id, destinations);
+            }
+        }
+        
+        if (aggregate.bucketPackets(i) == 0) continue;
         TrafficData point;
-        point.timestamp = min_time + (interval_pair.first * interval_duration);
-        point.bandwidth_mbps = convertToMbps(interval_pair.second.first, interval_duration);
-        point.packet_count = interval_pair.second.second;
+        point.timestamp = aggregate.bucketStart(i);
+        point.bandwidth_mbps = mbps;
+        point.packet_count = aggregate.bucketPackets(i);
+        point.distinct_sources = sources;
+        point.distinct_destinations = destinations;
         data.push_back(point);
     }
     
     std::cout << "Diagregasi menjadi " << data.size() << " interval waktu." << std::endl;
+    if (anomaly_detection_enabled) {
+        std::cout << "Detektor anomali: " << anomaly_detector.getEvents().size() << " interval ditandai." << std::endl;
+    }
 }
 
 void NetworkAnalyzer::generateHourlyPattern() {
     if (data.empty()) return;
     
-    // Buat pola 24 jam dari data yang tersedia
-    time_hours.clear();
-    bandwidth.clear();
-    
-    // Hitung rata-rata bandwidth dari data nyata
-    double avg_bandwidth = 0;
-    for (const auto& point : data) {
-        avg_bandwidth += point.bandwidth_mbps;
+    // Profil dihitung dari interval nyata (deterministik, tanpa noise acak)
+    std::vector<double> timestamps(data.size());
+    std::vector<double> values(data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        timestamps[i] = data[i].timestamp;
+        values[i] = data[i].bandwidth_mbps;
     }
-    avg_bandwidth /= data.size();
     
-    // Buat pola 24 jam yang realistis
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::normal_distribution<> noise(0, avg_bandwidth * 0.1); // 10% noise
+    ProfileOptions hourly_options = profile_options;
+    hourly_options.by_day_of_week = false;
+    hourly_profile = TrafficProfile(hourly_options);
+    hourly_profile.build(timestamps, values, interval_seconds);
     
-    for (int hour = 0; hour < 24; hour++) {
-        time_hours.push_back(hour);
-        
-        // Pola diurnal: rendah di malam hari, puncak di siang hari
-        double base_factor = 0.4 + 0.6 * (0.5 + 0.5 * sin(PI * (hour - 6) / 12));
-        
-        // Penyesuaian jam sibuk
-        if (hour >= 8 && hour <= 10) base_factor *= 1.3;   // Puncak pagi
-        if (hour >= 14 && hour <= 16) base_factor *= 1.2;  // Puncak siang
-        if (hour >= 19 && hour <= 21) base_factor *= 1.4;  // Puncak sore
-        if (hour >= 0 && hour <= 5) base_factor *= 0.3;    // Rendah malam
-        
-        double hourly_bandwidth = avg_bandwidth * base_factor + noise(gen);
-        bandwidth.push_back(std::max(0.1, hourly_bandwidth)); // Pastikan positif
+    weekly_profile = TrafficProfile(profile_options);
+    if (profile_options.by_day_of_week) {
+        weekly_profile.build(timestamps, values, interval_seconds);
+    }
+    
+    // Pola 24 jam = rata-rata bandwidth per jam lokal
+    clearSeries();
+    for (int hour = 0; hour < TrafficProfile::HOURS_PER_DAY; hour++) {
+        appendSample(hour, hourly_profile.slot(hour).mean);
     }
     
     std::cout << "Membuat pola lalu lintas 24 jam." << std::endl;
 }
 
-double NetworkAnalyzer::lagrangeInterpolation(double target_time) {
-    if (time_hours.empty() || bandwidth.empty()) {
-        std::cerr << "Error: Tidak ada data tersedia untuk interpolasi." << std::endl;
-        return 0.0;
-    }
+void NetworkAnalyzer::clearSeries() {
+    time_hours.clear();
+    bandwidth.clear();
+    bandwidth_stats.clear();
+    time_hours_sorted = true;
+    integral_index_valid = false;
+    series_revision++;
+}
+
+void NetworkAnalyzer::appendSample(double hour, double mbps) {
+    if (!time_hours.empty() && hour < time_hours.back()) time_hours_sorted = false;
+    time_hours.push_back(hour);
+    bandwidth.push_back(mbps);
+    bandwidth_stats.add(mbps);
+    integral_index_valid = false;
+    series_revision++;
+}
+
+void NetworkAnalyzer::viewSeries(const double* hours, const double* mbps, size_t count,
+                                 const std::shared_ptr<const void>& owner) {
+    clearSeries();
+    time_hours.assignView(hours, count, owner);
+    bandwidth.assignView(mbps, count, owner);
     
+    // Satu lintasan baca untuk ringkasan dan cek urutan, tanpa salinan
+    for (size_t i = 0; i < count; i++) {
+        if (i > 0 && hours[i] < hours[i - 1]) time_hours_sorted = false;
+        bandwidth_stats.add(mbps[i]);
+    }
+}
+
+double NetworkAnalyzer::lagrangeInterpolation(double target_time) {
+    double result = 0.0;
+    lagrangeInterpolation(&target_time, 1, &result);
+    return result;
+}
+
+double NetworkAnalyzer::interpolateScan(double target_time) const {
     // Batasi target_time ke rentang yang valid
     if (target_time < 0) target_time = 0;
     if (target_time > 23) target_time = 23;
@@ -180,52 +547,303 @@ double NetworkAnalyzer::lagrangeInterpolation(double target_time) {
     return result;
 }
 
+void NetworkAnalyzer::lagrangeInterpolation(const double* target_times, size_t count, double* results) {
+    if (time_hours.empty() || bandwidth.empty()) {
+        std::cerr << "Error: Tidak ada data tersedia untuk interpolasi." << std::endl;
+        std::fill(results, results + count, 0.0);
+        return;
+    }
+    
+    if (!time_hours_sorted) {
+        for (size_t i = 0; i < count; i++) results[i] = interpolateScan(target_times[i]);
+        return;
+    }
+    
+    const double* t = time_hours.data();
+    const double* y = bandwidth.data();
+    size_t n = time_hours.size();
+    bool sorted_queries = std::is_sorted(target_times, target_times + count);
+    const double unbounded = std::numeric_limits<double>::infinity();
+    
+    // Query diproses per blok: tahap 1 mencari segmen dan menulis operand
+    // ke array SoA di stack, tahap 2 menghitung semua hasil tanpa cabang
+    // sehingga loop-nya bisa divektorisasi compiler
+    const size_t BLOCK = 256;
+    double q[BLOCK], x0[BLOCK], dx[BLOCK], y0[BLOCK], dy[BLOCK], low[BLOCK], high[BLOCK];
+    size_t walk = 0; // Merge walk: indeks pertama dengan t >= target
+    
+    for (size_t base = 0; base < count; base += BLOCK) {
+        size_t m = std::min(BLOCK, count - base);
+        
+        for (size_t j = 0; j < m; j++) {
+            double target = target_times[base + j];
+            if (target < 0) target = 0;
+            if (target > 23) target = 23;
+            
+            size_t k;
+            if (sorted_queries) {
+                while (walk < n && t[walk] < target) walk++;
+                k = walk;
+            } else {
+                k = static_cast<size_t>(std::lower_bound(t, t + n, target) - t);
+            }
+            
+            // Kecocokan tepat (|t - target| < 0.01) dengan indeks terkecil
+            size_t first = k;
+            while (first > 0 && std::abs(t[first - 1] - target) < 0.01) first--;
+            size_t match = n;
+            if (first < k) match = first;
+            else if (k < n && std::abs(t[k] - target) < 0.01) match = k;
+            
+            size_t lower = 0, upper = n - 1;
+            if (match == n && k > 0 && k < n) {
+                lower = k - 1;
+                upper = k;
+            }
+            
+            q[j] = target;
+            if (match < n || t[upper] == t[lower]) {
+                // Nilai langsung tanpa pembatasan (sama seperti versi skalar)
+                x0[j] = target;
+                dx[j] = 1.0;
+                y0[j] = y[match < n ? match : lower];
+                dy[j] = 0.0;
+                low[j] = -unbounded;
+                high[j] = unbounded;
+            } else {
+                x0[j] = t[lower];
+                dx[j] = t[upper] - t[lower];
+                y0[j] = y[lower];
+                dy[j] = y[upper] - y[lower];
+                low[j] = 0.0;
+                high[j] = 10.0;
+            }
+        }
+        
+        // Blok terakhir diisi lane netral agar kernel selalu BLOCK iterasi
+        // (jumlah iterasi konstan: tanpa loop epilog, divektorisasi di -O2)
+        for (size_t j = m; j < BLOCK; j++) {
+            q[j] = x0[j] = y0[j] = dy[j] = low[j] = high[j] = 0.0;
+            dx[j] = 1.0;
+        }
+        
+        for (size_t j = 0; j < BLOCK; j++) {
+            double r = y0[j] + dy[j] * (q[j] - x0[j]) / dx[j];
+            r = r < low[j] ? 0.1 : r;
+            r = r > high[j] ? 10.0 : r;
+            q[j] = r;
+        }
+        std::copy(q, q + m, results + base);
+    }
+}
+
+bool NetworkAnalyzer::buildInterpolator(InterpolationMethod method, int degree, bool full_resolution) {
+    std::vector<double> x, y;
+    if (full_resolution && data.size() >= 2) {
+        x.reserve(data.size());
+        y.reserve(data.size());
+        for (const auto& point : data) {
+            x.push_back(point.timestamp);
+            y.push_back(point.bandwidth_mbps);
+        }
+    } else {
+        x = time_hours.toVector();
+        y = bandwidth.toVector();
+    }
+    
+    if (!series_interpolator.build(x.data(), y.data(), std::min(x.size(), y.size()), method, degree)) {
+        std::cerr << "Error: Interpolator membutuhkan minimal 2 titik dengan waktu naik tegas." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+double NetworkAnalyzer::interpolateSeries(double x) const {
+    if (!series_interpolator.ready()) {
+        std::cerr << "Error: Interpolator belum dibangun (panggil buildInterpolator)." << std::endl;
+        return 0.0;
+    }
+    return series_interpolator.evaluate(x);
+}
+
+void NetworkAnalyzer::interpolateSeries(const double* x, size_t count, double* results) const {
+    if (!series_interpolator.ready()) {
+        std::cerr << "Error: Interpolator belum dibangun (panggil buildInterpolator)." << std::endl;
+        std::fill(results, results + count, 0.0);
+        return;
+    }
+    series_interpolator.evaluate(x, count, results);
+}
+
+bool NetworkAnalyzer::exportInterpolatedSeries(const std::string& filename, double step) {
+    if (!series_interpolator.ready() || step <= 0) {
+        std::cerr << "Error: Interpolator belum dibangun atau langkah grid tidak valid." << std::endl;
+        return false;
+    }
+    
+    // Resample ke grid seragam dalam blok agar memori tetap kecil
+    double start = series_interpolator.minX();
+    size_t points = static_cast<size_t>((series_interpolator.maxX() - start) / step) + 1;
+    const size_t BLOCK = 4096;
+    std::vector<double> grid(BLOCK), values(BLOCK);
+    
+    std::ofstream outFile(filename);
+    outFile << "Time,Interpolated_Mbps\n";
+    for (size_t base = 0; base < points; base += BLOCK) {
+        size_t m = std::min(BLOCK, points - base);
+        for (size_t j = 0; j < m; j++) grid[j] = start + static_cast<double>(base + j) * step;
+        series_interpolator.evaluate(grid.data(), m, values.data());
+        for (size_t j = 0; j < m; j++) {
+            outFile << std::fixed << std::setprecision(3) << grid[j] << ","
+                    << std::setprecision(6) << values[j] << "\n";
+        }
+    }
+    
+    outFile.close();
+    std::cout << "Deret terinterpolasi (" << InterpolationEngine::methodName(series_interpolator.getMethod())
+              << ", " << points << " titik) diekspor ke " << filename << std::endl;
+    return true;
+}
+
 double NetworkAnalyzer::simpsonIntegration() {
     return simpsonIntegration(0.0, 23.0);
 }
 
+const CumulativeIntegralIndex& NetworkAnalyzer::integralIndex() {
+    if (!integral_index_valid) {
+        integral_index.build(time_hours.data(), bandwidth.data(), std::min(time_hours.size(), bandwidth.size()));
+        integral_index_valid = true;
+    }
+    return integral_index;
+}
+
 double NetworkAnalyzer::simpsonIntegration(double start_time, double end_time) {
     if (bandwidth.empty()) {
         std::cerr << "Error: Tidak ada data tersedia untuk integrasi." << std::endl;
         return 0.0;
     }
     
-    // Gunakan titik data yang ada dalam rentang
-    std::vector<double> x_vals, y_vals;
-    
-    for (size_t i = 0; i < time_hours.size(); i++) {
-        if (time_hours[i] >= start_time && time_hours[i] <= end_time) {
-            x_vals.push_back(time_hours[i]);
-            y_vals.push_back(bandwidth[i]);
+    double integral = 0.0;
+    if (time_hours_sorted) {
+        // Dua pencarian biner pada indeks prefix, tanpa menyalin titik
+        if (!integralIndex().simpson(start_time, end_time, integral)) {
+            std::cerr << "Error: Titik data tidak cukup untuk aturan Simpson." << std::endl;
+            return 0.0;
         }
+        return integral;
     }
     
-    if (x_vals.size() < 3) {
+    // Waktu tidak terurut: dua lintasan atas titik dalam rentang
+    // (hitung, lalu jumlahkan berbobot) tanpa vektor sementara
+    size_t count = 0;
+    for (size_t i = 0; i < time_hours.size(); i++) {
+        if (time_hours[i] >= start_time && time_hours[i] <= end_time) count++;
+    }
+    if (count < 3) {
         std::cerr << "Error: Titik data tidak cukup untuk aturan Simpson." << std::endl;
         return 0.0;
     }
     
-    // Pastikan kita memiliki jumlah interval genap
-    int n = x_vals.size() - 1;
-    if (n % 2 != 0) {
-        n--; // Gunakan n-1 interval
+    // Simpson 1/3 pada m interval genap, aturan 3/8 untuk tiga interval
+    // terakhir jika jumlah interval ganjil (titik ke-m mendapat kedua bobot)
+    size_t n = count - 1;
+    size_t m = (n % 2 == 0) ? n : n - 3;
+    static const double THREE_EIGHTHS[4] = {1.0, 3.0, 3.0, 1.0};
+    
+    double x_first = 0.0, x_last = 0.0;
+    size_t k = 0;
+    for (size_t i = 0; i < time_hours.size() && k <= n; i++) {
+        if (time_hours[i] < start_time || time_hours[i] > end_time) continue;
+        double weight = 0.0;
+        if (m > 0 && k <= m) weight += ((k == 0 || k == m) ? 1.0 : (k % 2 == 1 ? 4.0 : 2.0)) / 3.0;
+        if (m < n && k >= m) weight += THREE_EIGHTHS[k - m] * 3.0 / 8.0;
+        integral += weight * bandwidth[i];
+        if (k == 0) x_first = time_hours[i];
+        if (k == n) x_last = time_hours[i];
+        k++;
     }
     
-    double h = (x_vals[n] - x_vals[0]) / n;
-    double integral = y_vals[0] + y_vals[n];
+    double h = (x_last - x_first) / n;
+    return integral * h;
+}
+
+double NetworkAnalyzer::integrateBandwidth(double start_time, double end_time) {
+    if (bandwidth.size() < 2) {
+        std::cerr << "Error: Tidak ada data tersedia untuk integrasi." << std::endl;
+        return 0.0;
+    }
+    if (!time_hours_sorted) {
+        std::cerr << "Error: Integral rentang membutuhkan waktu yang terurut naik." << std::endl;
+        return 0.0;
+    }
+    return integralIndex().trapezoid(start_time, end_time);
+}
+
+bool NetworkAnalyzer::computeDerivatives(size_t half_window, int order, std::vector<double>& hours,
+                                         std::vector<double>& smoothed, std::vector<double>& gradient,
+                                         std::vector<double>& curvature) const {
+    DerivativeEngine engine;
+    if (!engine.configure(half_window, order)) {
+        std::cerr << "Error: Jendela/orde Savitzky-Golay tidak valid (orde harus < 2*jendela+1, maks "
+                  << DerivativeEngine::MAX_ORDER << ")." << std::endl;
+        return false;
+    }
     
-    // Tambahkan 4 * (suku berindeks ganjil)
-    for (int i = 1; i < n; i += 2) {
-        integral += 4 * y_vals[i];
+    std::vector<double> values;
+    if (data.size() >= 2) {
+        hours.resize(data.size());
+        values.resize(data.size());
+        for (size_t i = 0; i < data.size(); i++) {
+            hours[i] = data[i].timestamp / 3600.0;
+            values[i] = data[i].bandwidth_mbps;
+        }
+    } else {
+        hours = time_hours.toVector();
+        values = bandwidth.toVector();
     }
     
-    // Tambahkan 2 * (suku berindeks genap)
-    for (int i = 2; i < n; i += 2) {
-        integral += 2 * y_vals[i];
+    size_t n = std::min(hours.size(), values.size());
+    hours.resize(n);
+    smoothed.resize(n);
+    gradient.resize(n);
+    curvature.resize(n);
+    if (!engine.compute(hours.data(), values.data(), n, smoothed.data(), gradient.data(), curvature.data())) {
+        std::cerr << "Error: Turunan membutuhkan waktu naik tegas dan minimal " << order + 1 << " titik." << std::endl;
+        return false;
     }
+    return true;
+}
+
+bool NetworkAnalyzer::exportDerivatives(const std::string& filename, size_t half_window, int order) const {
+    std::vector<double> hours, smoothed, gradient, curvature;
+    if (!computeDerivatives(half_window, order, hours, smoothed, gradient, curvature)) return false;
     
-    integral *= h / 3.0;
-    return integral;
+    std::ofstream outFile(filename);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Tidak dapat membuat file " << filename << std::endl;
+        return false;
+    }
+    outFile << "Time_Hour,Smoothed_Mbps,Gradient_Mbps_per_Hour,Curvature_Mbps_per_Hour2\n";
+    for (size_t i = 0; i < hours.size(); i++) {
+        outFile << std::fixed << std::setprecision(6) << hours[i] << "," << smoothed[i] << ","
+                << gradient[i] << "," << curvature[i] << "\n";
+    }
+    outFile.close();
+    std::cout << "Turunan Savitzky-Golay (" << hours.size() << " titik) diekspor ke " << filename << std::endl;
+    return true;
+}
+
+QuadratureResult NetworkAnalyzer::integrateInterpolated(double start, double end, QuadratureRule rule,
+                                                        const QuadratureOptions& options) const {
+    if (!series_interpolator.ready()) {
+        std::cerr << "Error: Interpolator belum dibangun (panggil buildInterpolator)." << std::endl;
+        QuadratureResult empty;
+        empty.converged = false;
+        return empty;
+    }
+    const InterpolationEngine& engine = series_interpolator;
+    return AdaptiveQuadrature::integrate([&engine](double x) { return engine.evaluate(x); },
+                                         start, end, rule, options);
 }
 
 void NetworkAnalyzer::calculateStatistics() {
@@ -237,29 +855,11 @@ void NetworkAnalyzer::calculateStatistics() {
               << getAverageBandwidth() << " Mbps" << std::endl;
     std::cout << "Bandwidth puncak: " << getMaxBandwidth() << " Mbps" << std::endl;
     std::cout << "Bandwidth minimum: " << getMinBandwidth() << " Mbps" << std::endl;
+    std::cout << "Deviasi standar: " << getBandwidthStdDev() << " Mbps" << std::endl;
     std::cout << "Rasio puncak-ke-rata-rata: " 
               << getMaxBandwidth() / getAverageBandwidth() << std::endl;
 }
 
-double NetworkAnalyzer::getMaxBandwidth() {
-    if (bandwidth.empty()) return 0.0;
-    return *std::max_element(bandwidth.begin(), bandwidth.end());
-}
-
-double NetworkAnalyzer::getMinBandwidth() {
-    if (bandwidth.empty()) return 0.0;
-    return *std::min_element(bandwidth.begin(), bandwidth.end());
-}
-
-double NetworkAnalyzer::getAverageBandwidth() {
-    if (bandwidth.empty()) return 0.0;
-    double sum = 0.0;
-    for (double bw : bandwidth) {
-        sum += bw;
-    }
-    return sum / bandwidth.size();
-}
-
 void NetworkAnalyzer::displayResults() {
     std::cout << "\n=== HASIL ANALISIS LALU LINTAS JARINGAN ===" << std::endl;
     std::cout << std::fixed << std::setprecision(3);
@@ -330,6 +930,11 @@ void NetworkAnalyzer::exportResults(const std::string& filename) {
 }
 
 bool NetworkAnalyzer::loadProcessedData(const std::string& filename) {
+    // File kolumnar biner dikenali dari magic-nya, selain itu CSV
+    if (columnar::isColumnarFile(filename)) {
+        return loadProcessedBinary(filename);
+    }
+    
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Error: Tidak dapat membuka file terproses " << filename << std::endl;
@@ -339,8 +944,10 @@ bool NetworkAnalyzer::loadProcessedData(const std::string& filename) {
     std::string line;
     std::getline(file, line); // Lewati header
     
-    time_hours.clear();
-    bandwidth.clear();
+    // File terproses CSV tidak memuat deret resolusi penuh; buang sisa
+    // dataset sebelumnya agar tidak tercampur dengan pola yang baru
+    clearSeries();
+    data.clear();
     
     while (std::getline(file, line)) {
         std::stringstream ss(line);
@@ -352,8 +959,7 @@ bool NetworkAnalyzer::loadProcessedData(const std::string& filename) {
         std::getline(ss, item, ',');
         double bw = std::stod(item);
         
-        time_hours.push_back(time);
-        bandwidth.push_back(bw);
+        appendSample(time, bw);
     }
     
     file.close();
@@ -372,4 +978,347 @@ void NetworkAnalyzer::saveProcessedData(const std::string& filename) {
     
     outFile.close();
     std::cout << "Data terproses disimpan ke " << filename << std::endl;
-}
\ No newline at end of file
+}
+
+bool NetworkAnalyzer::loadProcessedBinary(const std::string& filename) {
+    // Pemetaan dibagi dengan time_hours/bandwidth agar tetap hidup selama
+    // kolom masih ditampilkan langsung dari file
+    std::shared_ptr<columnar::ColumnarFile> mapping = std::make_shared<columnar::ColumnarFile>();
+    const columnar::ColumnarFile& file = *mapping;
+    if (!mapping->open(filename)) {
+        std::cerr << "Error: File kolumnar tidak valid " << filename << std::endl;
+        return false;
+    }
+    
+    // Pola per jam (wajib)
+    size_t hour_count, bw_count;
+    const double* hours = file.float64Column("time_hour", hour_count);
+    const double* bws = file.float64Column("bandwidth_mbps", bw_count);
+    if (hours == nullptr || bws == nullptr || hour_count != bw_count) {
+        std::cerr << "Error: Kolom time_hour/bandwidth_mbps tidak ditemukan di " << filename << std::endl;
+        return false;
+    }
+    
+    // Kolom ditampilkan langsung dari halaman yang dipetakan, tanpa parsing
+    // teks maupun salinan
+    viewSeries(hours, bws, hour_count, mapping);
+    data.clear(); // Jangan campur dengan deret penuh dataset sebelumnya
+    
+    // Deret resolusi penuh (opsional)
+    size_t ts_count, mbps_count, packet_count;
+    const double* timestamps = file.float64Column("timestamp", ts_count);
+    const double* interval_mbps = file.float64Column("interval_mbps", mbps_count);
+    const int64_t* packets = file.int64Column("packet_count", packet_count);
+    if (timestamps != nullptr && interval_mbps != nullptr && packets != nullptr &&
+        ts_count == mbps_count && ts_count == packet_count) {
+        data.resize(ts_count);
+        for (size_t i = 0; i < ts_count; i++) {
+            data[i].timestamp = timestamps[i];
+            data[i].bandwidth_mbps = interval_mbps[i];
+            data[i].packet_count = packets[i];
+            data[i].distinct_sources = 0.0;
+            data[i].distinct_destinations = 0.0;
+        }
+        
+        // Estimasi host unik (opsional, ditulis sejak HyperLogLog ditambahkan)
+        size_t src_count, dst_count;
+        const double* sources = file.float64Column("distinct_sources", src_count);
+        const double* destinations = file.float64Column("distinct_destinations", dst_count);
+        if (sources != nullptr && destinations != nullptr && src_count == ts_count && dst_count == ts_count) {
+            for (size_t i = 0; i < ts_count; i++) {
+                data[i].distinct_sources = sources[i];
+                data[i].distinct_destinations = destinations[i];
+            }
+        }
+    }
+    
+    std::cout << "Memuat " << time_hours.size() << " titik data terproses (biner v"
+              << file.version() << ")." << std::endl;
+    return true;
+}
+
+bool NetworkAnalyzer::saveProcessedBinary(const std::string& filename) {
+    // Deret resolusi penuh disusun ulang dari array-of-struct ke kolom
+    std::vector<double> timestamps(data.size());
+    std::vector<double> interval_mbps(data.size());
+    std::vector<int64_t> packets(data.size());
+    std::vector<double> sources(data.size());
+    std::vector<double> destinations(data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        timestamps[i] = data[i].timestamp;
+        interval_mbps[i] = data[i].bandwidth_mbps;
+        packets[i] = data[i].packet_count;
+        sources[i] = data[i].distinct_sources;
+        destinations[i] = data[i].distinct_destinations;
+    }
+    
+    columnar::ColumnarWriter writer;
+    writer.addColumn("time_hour", time_hours.data(), time_hours.size());
+    writer.addColumn("bandwidth_mbps", bandwidth.data(), bandwidth.size());
+    writer.addColumn("timestamp", timestamps.data(), timestamps.size());
+    writer.addColumn("interval_mbps", interval_mbps.data(), interval_mbps.size());
+    writer.addColumn("packet_count", packets.data(), packets.size());
+    writer.addColumn("distinct_sources", sources.data(), sources.size());
+    writer.addColumn("distinct_destinations", destinations.data(), destinations.size());
+    
+    if (!writer.write(filename)) {
+        std::cerr << "Error: Gagal menulis file kolumnar " << filename << std::endl;
+        return false;
+    }
+    std::cout << "Data terproses (biner) disimpan ke " << filename << std::endl;
+    return true;
+}
+
+void NetworkAnalyzer::printTopFlows(size_t limit) {
+    if (flows.empty()) {
+        std::cout << "Tidak ada data flow. Aktifkan agregasi flow lalu muat ulang data mentah." << std::endl;
+        return;
+    }
+    
+    std::cout << "\n=== TOP " << limit << " FLOW (SELURUH CAPTURE) ===" << std::endl;
+    std::cout << "Source IP\t\tDestination IP\t\tProtokol\tBytes\t\tPaket" << std::endl;
+    for (const auto& flow : flows.flowTotals(limit)) {
+        std::cout << flow.key.src.toString() << "\t\t" << flow.key.dst.toString()
+                  << "\t\t" << flows.protocolName(flow.key.protocol)
+                  << "\t\t" << flow.bytes << "\t\t" << flow.packets << std::endl;
+    }
+    
+    std::cout << "\n=== TOP " << limit << " HOST SUMBER ===" << std::endl;
+    for (const auto& host : flows.hostTotals(true, limit)) {
+        std::cout << host.host.toString() << "\t\t" << host.bytes << " bytes\t"
+                  << host.packets << " paket" << std::endl;
+    }
+    
+    std::cout << "\n=== TOP " << limit << " HOST TUJUAN ===" << std::endl;
+    for (const auto& host : flows.hostTotals(false, limit)) {
+        std::cout << host.host.toString() << "\t\t" << host.bytes << " bytes\t"
+                  << host.packets << " paket" << std::endl;
+    }
+}
+
+void NetworkAnalyzer::exportFlowSeries(const std::string& filename) {
+    std::ofstream outFile(filename);
+    
+    outFile << "Interval_Start,Source_IP,Destination_IP,Protocol,Bytes,Packets,Bandwidth_Mbps\n";
+    
+    for (const auto& record : flows.records()) {
+        double start = flow_origin + record.interval_id * interval_seconds;
+        outFile << std::fixed << std::setprecision(3) << start << ","
+                << record.key.src.toString() << "," << record.key.dst.toString() << ","
+                << flows.protocolName(record.key.protocol) << ","
+                << record.bytes << "," << record.packets << ","
+                << std::setprecision(6) << convertToMbps(static_cast<double>(record.bytes), interval_seconds) << "\n";
+    }
+    
+    outFile.close();
+    std::cout << "Deret per-flow diekspor ke " << filename << std::endl;
+}
+
+void NetworkAnalyzer::printTopTalkers(size_t limit) {
+    if (!heavy_hitters.enabled() || heavy_hitters.intervalCount() == 0) {
+        std::cout << "Tidak ada data heavy hitter. Aktifkan lalu muat ulang data mentah." << std::endl;
+        return;
+    }
+    
+    // Sketch per interval digabung menjadi ringkasan seluruh capture
+    const char* titles[2] = {"SUMBER", "TUJUAN"};
+    for (int direction = 0; direction < 2; direction++) {
+        SpaceSavingSketch combined = heavy_hitters.combined(direction == 0);
+        std::cout << "\n=== TOP " << limit << " TALKER " << titles[direction]
+                  << " (" << heavy_hitters.getCapacity() << " counter, galat <= "
+                  << combined.errorBound() << " bytes) ===" << std::endl;
+        for (const auto& hitter : combined.top(limit)) {
+            std::cout << hitter.host.toString() << "\t\t~" << hitter.bytes
+                      << " bytes (galat <= " << hitter.error << ")" << std::endl;
+        }
+    }
+}
+
+void NetworkAnalyzer::exportTopTalkers(const std::string& filename, size_t limit) {
+    std::ofstream outFile(filename);
+    
+    outFile << "Interval_Start,Direction,Rank,IP,Bytes_Estimate,Max_Error\n";
+    
+    for (size_t slot = 0; slot < heavy_hitters.intervalCount(); slot++) {
+        double start = flow_origin + heavy_hitters.intervalId(slot) * interval_seconds;
+        for (int direction = 0; direction < 2; direction++) {
+            const SpaceSavingSketch& sketch = direction == 0 ? heavy_hitters.sourceSketch(slot)
+                                                             : heavy_hitters.destinationSketch(slot);
+            size_t rank = 1;
+            for (const auto& hitter : sketch.top(limit)) {
+                outFile << std::fixed << std::setprecision(3) << start << ","
+                        << (direction == 0 ? "src" : "dst") << "," << rank++ << ","
+                        << hitter.host.toString() << "," << hitter.bytes << ","
+                        << hitter.error << "\n";
+            }
+        }
+    }
+    
+    outFile.close();
+    std::cout << "Top talker per interval diekspor ke " << filename << std::endl;
+}
+
+double NetworkAnalyzer::distinctHostsBetween(double start_time, double end_time, bool by_source) const {
+    if (!distinct_hosts.enabled()) return 0.0;
+    // Interval yang beririsan dengan [start_time, end_time)
+    int64_t first_id = static_cast<int64_t>(std::floor((start_time - flow_origin) / interval_seconds));
+    int64_t last_id = static_cast<int64_t>(std::ceil((end_time - flow_origin) / interval_seconds)) - 1;
+    return distinct_hosts.combined(first_id, last_id, by_source).estimate();
+}
+
+void NetworkAnalyzer::printDistinctHostSummary() {
+    if (!distinct_hosts.enabled() || distinct_hosts.intervalCount() == 0) {
+        std::cout << "Tidak ada data host unik. Aktifkan HyperLogLog lalu muat ulang data mentah." << std::endl;
+        return;
+    }
+    
+    double first = flow_origin + distinct_hosts.firstIntervalId() * interval_seconds;
+    double last = first + distinct_hosts.intervalCount() * interval_seconds;
+    HyperLogLog probe(distinct_hosts.getPrecision());
+    
+    std::cout << "\n=== HOST UNIK (HYPERLOGLOG, galat standar ~" << std::fixed << std::setprecision(1)
+              << probe.standardError() * 100 << "%) ===" << std::endl;
+    std::cout << "Seluruh capture: " << std::setprecision(0)
+              << distinctHostsBetween(first, last, true) << " sumber, "
+              << distinctHostsBetween(first, last, false) << " tujuan" << std::endl;
+    
+    // Union per hari dari sketch interval, tanpa memproses ulang paket
+    std::cout << "\nHari\tSumber unik\tTujuan unik" << std::endl;
+    int day = 1;
+    for (double start = first; start < last; start += 86400.0, day++) {
+        std::cout << day << "\t" << distinctHostsBetween(start, start + 86400.0, true) << "\t\t"
+                  << distinctHostsBetween(start, start + 86400.0, false) << std::endl;
+    }
+    
+    // Interval dengan sumber unik terbanyak (indikasi scan / DDoS)
+    size_t peak = 0;
+    for (size_t i = 1; i < data.size(); i++) {
+        if (data[i].distinct_sources > data[peak].distinct_sources) peak = i;
+    }
+    if (!data.empty()) {
+        std::cout << "\nPuncak sumber unik: " << data[peak].distinct_sources << " host pada interval "
+                  << std::setprecision(3) << data[peak].timestamp << std::endl;
+    }
+}
+
+void NetworkAnalyzer::exportIntervalSeries(const std::string& filename) {
+    std::ofstream outFile(filename);
+    
+    outFile << "Timestamp,Bandwidth_Mbps,Packet_Count,Distinct_Sources,Distinct_Destinations\n";
+    
+    for (const auto& point : data) {
+        outFile << std::fixed << std::setprecision(3) << point.timestamp << ","
+                << std::setprecision(6) << point.bandwidth_mbps << "," << point.packet_count << ","
+                << std::setprecision(0) << point.distinct_sources << "," << point.distinct_destinations << "\n";
+    }
+    
+    outFile.close();
+    std::cout << "Deret per interval diekspor ke " << filename << std::endl;
+}
+
+void NetworkAnalyzer::printHourlyProfile() {
+    if (hourly_profile.empty()) {
+        std::cout << "Profil belum tersedia. Muat data mentah terlebih dahulu." << std::endl;
+        return;
+    }
+    
+    std::cout << "\n=== PROFIL JAM-HARIAN (" << hourly_profile.dayCount() << " hari, UTC" << std::fixed << std::setprecision(1)
+              << std::showpos << profile_options.utc_offset_hours << std::noshowpos << ") ===" << std::endl;
+    std::cout << "Jam\tInterval\tMean\t\tMedian\t\tMax (Mbps)" << std::endl;
+    for (size_t i = 0; i < hourly_profile.slotCount(); i++) {
+        const ProfileSlot& slot = hourly_profile.slot(i);
+        std::cout << std::setw(2) << std::setfill('0') << hourly_profile.slotHour(i) << ":00" << std::setfill(' ')
+                  << "\t" << slot.count << "\t\t" << std::fixed << std::setprecision(3)
+                  << slot.mean << "\t\t" << slot.median << "\t\t" << slot.max
+                  << (slot.interpolated ? "\t(interpolasi)" : "") << std::endl;
+    }
+    
+    if (weekly_profile.empty()) return;
+    
+    // Ringkasan per hari: rata-rata dari 24 slot jam setiap hari
+    std::cout << "\n=== PROFIL PER HARI DALAM MINGGU ===" << std::endl;
+    std::cout << "Hari\t\tMean\t\tMax (Mbps)\tJam terisi" << std::endl;
+    for (int day = 0; day < TrafficProfile::DAYS_PER_WEEK; day++) {
+        double sum = 0.0, max_value = 0.0;
+        int observed = 0;
+        for (int hour = 0; hour < TrafficProfile::HOURS_PER_DAY; hour++) {
+            const ProfileSlot& slot = weekly_profile.slot(day * TrafficProfile::HOURS_PER_DAY + hour);
+            sum += slot.mean;
+            max_value = std::max(max_value, slot.max);
+            if (!slot.interpolated) observed++;
+        }
+        std::cout << std::left << std::setw(8) << TrafficProfile::dayName(day) << std::right
+                  << "\t" << sum / TrafficProfile::HOURS_PER_DAY << "\t\t" << max_value
+                  << "\t\t" << observed << "/24" << std::endl;
+    }
+}
+
+void NetworkAnalyzer::exportProfile(const std::string& filename) {
+    std::ofstream outFile(filename);
+    
+    outFile << "Day,Hour,Interval_Count,Mean_Mbps,Median_Mbps,Max_Mbps,Interpolated\n";
+    
+    const TrafficProfile& profile = weekly_profile.empty() ? hourly_profile : weekly_profile;
+    for (size_t i = 0; i < profile.slotCount(); i++) {
+        const ProfileSlot& slot = profile.slot(i);
+        outFile << TrafficProfile::dayName(profile.slotDay(i)) << "," << profile.slotHour(i) << ","
+                << slot.count << "," << std::fixed << std::setprecision(6)
+                << slot.mean << "," << slot.median << "," << slot.max << ","
+                << (slot.interpolated ? 1 : 0) << "\n";
+    }
+    
+    outFile.close();
+    std::cout << "Profil jam-harian diekspor ke " << filename << std::endl;
+}
+
+double NetworkAnalyzer::bandwidthPercentile(double q) const {
+    return bandwidth_quantiles.combined().quantile(q);
+}
+
+double NetworkAnalyzer::bandwidthPercentileBetween(double start_time, double end_time, double q) const {
+    return bandwidth_quantiles.combined(start_time, end_time).quantile(q);
+}
+
+void NetworkAnalyzer::printPercentiles() {
+    if (bandwidth_quantiles.empty()) {
+        std::cout << "Sketch kuantil belum tersedia. Muat data mentah terlebih dahulu." << std::endl;
+        return;
+    }
+    
+    KllSketch all = bandwidth_quantiles.combined();
+    std::cout << "\n=== PERSENTIL BANDWIDTH PER INTERVAL (" << all.count() << " sampel, "
+              << all.retained() << " nilai disimpan) ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "p50: " << all.quantile(0.50) << " Mbps" << std::endl;
+    std::cout << "p95: " << all.quantile(0.95) << " Mbps (dasar billing)" << std::endl;
+    std::cout << "p99: " << all.quantile(0.99) << " Mbps" << std::endl;
+    
+    // Sketch harian: dasar penggabungan ke periode billing bulanan
+    std::cout << "\nHari (UTC)\tSampel\tp50\t\tp95\t\tp99" << std::endl;
+    for (size_t i = 0; i < bandwidth_quantiles.dayCount(); i++) {
+        const KllSketch& day = bandwidth_quantiles.day(i);
+        if (day.empty()) continue;
+        std::cout << std::setprecision(0) << bandwidth_quantiles.dayStart(i) << "\t" << day.count()
+                  << "\t" << std::setprecision(6) << day.quantile(0.50) << "\t" << day.quantile(0.95)
+                  << "\t" << day.quantile(0.99) << std::endl;
+    }
+}
+
+bool NetworkAnalyzer::saveQuantileSketches(const std::string& filename) const {
+    if (!bandwidth_quantiles.save(filename)) {
+        std::cerr << "Error: Gagal menulis sketch kuantil " << filename << std::endl;
+        return false;
+    }
+    std::cout << "Sketch kuantil harian disimpan ke " << filename << std::endl;
+    return true;
+}
+
+bool NetworkAnalyzer::mergeQuantileSketches(const std::string& filename) {
+    DailyQuantileSketches other(quantile_accuracy);
+    if (!other.load(filename)) {
+        std::cerr << "Error: File sketch kuantil tidak valid " << filename << std::endl;
+        return false;
+    }
+    bandwidth_quantiles.merge(other);
+    return true;
+}
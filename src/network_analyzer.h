@@ -9,61 +9,219 @@
 #include <cmath>
 #include <iomanip>
 #include <algorithm>
+#include "traffic_aggregator.h"
+#include "rollup_pyramid.h"
+#include "flow_aggregator.h"
+#include "heavy_hitters.h"
+#include "hyperloglog.h"
+#include "traffic_profile.h"
+#include "running_stats.h"
+#include "series_column.h"
+#include "kll_sketch.h"
+#include "interpolation_engine.h"
+#include "integral_index.h"
+#include "adaptive_quadrature.h"
+#include "derivative_engine.h"
+#include "anomaly_detector.h"
+#include "peak_finder.h"
+#include "ode_forecaster.h"
+#include "ensemble_forecaster.h"
+#include "model_calibrator.h"
 
 // Definisikan M_PI jika tidak tersedia
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+// Deret per link yang dipantau detektor anomali saat ingest
+enum LinkMetric {
+    METRIC_BANDWIDTH = 0,
+    METRIC_PACKETS,
+    METRIC_DISTINCT_SOURCES,
+    METRIC_DISTINCT_DESTINATIONS,
+    METRIC_COUNT
+};
+
+struct IngestOptions;
+class IngestPipeline;
+
 struct TrafficData {
     double timestamp;      // Cap waktu Unix
     double bandwidth_mbps; // Bandwidth dalam Mbps
-    int packet_count;      // Jumlah paket dalam interval ini
+    long long packet_count; // Jumlah paket dalam interval ini
+    double distinct_sources;      // Estimasi IP sumber unik (0 jika HLL nonaktif)
+    double distinct_destinations; // Estimasi IP tujuan unik
 };
 
 class NetworkAnalyzer {
 protected:  // UBAH DARI PRIVATE KE PROTECTED
     std::vector<TrafficData> data;
-    std::vector<double> time_hours;    // Waktu dalam jam (0-24)
-    std::vector<double> bandwidth;     // Nilai bandwidth yang sesuai
+    SeriesColumn time_hours;           // Waktu dalam jam (0-24)
+    SeriesColumn bandwidth;            // Nilai bandwidth yang sesuai
+    RunningStats bandwidth_stats;      // Ringkasan 'bandwidth', diperbarui saat append
+    bool time_hours_sorted;            // time_hours menaik (syarat pencarian biner)
+    CumulativeIntegralIndex integral_index; // Prefix integral atas time_hours/bandwidth
+    bool integral_index_valid;         // false setelah deret berubah (dibangun ulang lazily)
+    unsigned long series_revision;     // Naik setiap time_hours/bandwidth berubah (kunci cache turunan)
+    double last_ingest_mbps;           // Throughput ingest terakhir (MB/s)
+    double interval_seconds;           // Lebar interval agregasi (detik)
+    bool rollup_enabled;               // Bangun piramida rollup saat ingest (bawaan: mati)
+    RollupPyramid rollup;              // Resolusi 1 detik s/d 1 hari
+    bool flows_enabled;                // Agregasi per-flow saat ingest
+    FlowAggregator flows;              // Byte/paket per flow per interval
+    double flow_origin;                // Origin interval (flow, heavy hitter, HLL)
+    size_t heavy_hitter_capacity;      // Counter Space-Saving per interval (0 = nonaktif)
+    HeavyHitterTracker heavy_hitters;  // Top talker per interval
+    int distinct_precision;            // Presisi HyperLogLog (0 = nonaktif)
+    DistinctHostTracker distinct_hosts; // Host unik per interval
+    ProfileOptions profile_options;    // Zona waktu & pengelompokan hari
+    TrafficProfile hourly_profile;     // Profil 24 jam dari data nyata
+    TrafficProfile weekly_profile;     // Profil 7 x 24 jam (jika diaktifkan)
+    size_t quantile_accuracy;          // Parameter k sketch KLL
+    DailyQuantileSketches bandwidth_quantiles; // Kuantil bandwidth interval per hari UTC
+    InterpolationEngine series_interpolator;   // Interpolator deret (dibangun sekali)
+    bool anomaly_detection_enabled;    // Pantau setiap interval saat deret dibangun
+    AnomalyDetectorOptions anomaly_options;
+    StreamingAnomalyDetector anomaly_detector; // Satu deret per LinkMetric
     
     // Fungsi pembantu
     double convertToMbps(double bytes, double time_interval);
-    void aggregateData(const std::vector<std::pair<double, int>>& raw_packets);
+    void buildTrafficSeries(const TrafficAggregate& aggregate);
+    IngestOptions makeIngestOptions() const;
+    void finishIngest(const IngestPipeline& pipeline);
     void generateHourlyPattern();
+    // Satu-satunya jalur untuk mengubah time_hours/bandwidth agar
+    // bandwidth_stats selalu sinkron
+    void clearSeries();
+    void appendSample(double hour, double mbps);
+    // Pakai kolom milik 'owner' (mis. file .ntcol yang dipetakan) tanpa menyalin
+    void viewSeries(const double* hours, const double* mbps, size_t count,
+                    const std::shared_ptr<const void>& owner);
+    double interpolateScan(double target_time) const; // Jalur linear untuk waktu tidak terurut
+    const CumulativeIntegralIndex& integralIndex();
     
 public:
     // Konstruktor
     NetworkAnalyzer();
     
+    // Lebar interval agregasi: 1 ms s/d 1 jam (default 5 menit)
+    bool setIntervalDuration(double seconds);
+    double getIntervalDuration() const { return interval_seconds; }
+    void setRollupEnabled(bool enabled) { rollup_enabled = enabled; }
+    bool isRollupEnabled() const { return rollup_enabled; }
+    void setFlowAggregationEnabled(bool enabled) { flows_enabled = enabled; }
+    // Heavy hitter: kapasitas counter langsung, atau dari batas galat relatif
+    // (epsilon = 0.01 -> 100 counter, galat <= 1% byte interval)
+    void setHeavyHitterCapacity(size_t counters) { heavy_hitter_capacity = counters; }
+    void setHeavyHitterErrorBound(double epsilon) {
+        heavy_hitter_capacity = SpaceSavingSketch::capacityForError(epsilon);
+    }
+    // Host unik per interval: presisi 4-16 bit (12 = galat ~1.6%), 0 = nonaktif
+    bool setDistinctHostPrecision(int bits);
+    // Profil jam-harian: offset UTC dan profil per hari dalam minggu
+    void setProfileOptions(const ProfileOptions& options) { profile_options = options; }
+    // Akurasi sketch kuantil: k lebih besar = lebih akurat (default 200)
+    bool setQuantileAccuracy(size_t k);
+    // Detektor anomali EWMA/MAD online untuk bandwidth, paket dan host unik
+    void setAnomalyDetection(bool enabled, const AnomalyDetectorOptions& options = AnomalyDetectorOptions());
+    
     // Pemuatan dan pemrosesan data
     bool loadRawData(const std::string& filename);
+    bool loadRawDataMapped(const std::string& filename); // mmap + parsing tanpa alokasi
+    bool loadRawDataParallel(const std::string& filename, unsigned num_threads = 0); // 0 = semua core
     bool loadProcessedData(const std::string& filename);
-    void saveProcessedData(const std::string& filename);
+    void saveProcessedData(const std::string& filename);   // Ekspor CSV
+    bool loadProcessedBinary(const std::string& filename); // Format kolumnar .ntcol
+    bool saveProcessedBinary(const std::string& filename);
     
     // Metode numerik
     double lagrangeInterpolation(double target_time);
+    // Catatan: lagrangeInterpolation mempertahankan perilaku lama (linear,
+    // jam 0-23, dibatasi 10 Mbps). Untuk interpolasi sesungguhnya pada
+    // deret sembarang gunakan buildInterpolator() + interpolateSeries().
+    // Versi batch: results[i] = lagrangeInterpolation(target_times[i]).
+    // Query terurut dijawab dengan satu merge walk, selain itu pencarian biner.
+    void lagrangeInterpolation(const double* target_times, size_t count, double* results);
     double simpsonIntegration();
+    // Bangun interpolator atas deret resolusi penuh (timestamp interval,
+    // Mbps) atau, jika full_resolution = false / data kosong, pola 24 jam
+    bool buildInterpolator(InterpolationMethod method, int degree = InterpolationEngine::DEFAULT_DEGREE,
+                           bool full_resolution = true);
+    double interpolateSeries(double x) const;
+    void interpolateSeries(const double* x, size_t count, double* results) const;
+    bool exportInterpolatedSeries(const std::string& filename, double step);
     double simpsonIntegration(double start_time, double end_time);
+    // Integral trapesium bandwidth dengan batas sembarang (Mbps x jam), O(log n)
+    double integrateBandwidth(double start_time, double end_time);
+    // Kuadratur adaptif atas interpolator (satuan x interpolator: detik untuk
+    // deret penuh, jam untuk pola 24 jam); evaluasi terkumpul di bagian kasar
+    QuadratureResult integrateInterpolated(double start, double end,
+                                           QuadratureRule rule = QuadratureRule::AdaptiveSimpson,
+                                           const QuadratureOptions& options = QuadratureOptions()) const;
+    // Turunan Savitzky-Golay atas deret resolusi penuh (jam sejak epoch,
+    // Mbps, Mbps/jam, Mbps/jam^2); pola 24 jam jika belum ada data interval
+    bool computeDerivatives(size_t half_window, int order, std::vector<double>& hours,
+                            std::vector<double>& smoothed, std::vector<double>& gradient,
+                            std::vector<double>& curvature) const;
+    bool exportDerivatives(const std::string& filename, size_t half_window = DerivativeEngine::DEFAULT_HALF_WINDOW,
+                           int order = DerivativeEngine::DEFAULT_ORDER) const;
     
     // Fungsi analisis
     void calculateStatistics();
-    double getMaxBandwidth();
-    double getMinBandwidth();
-    double getAverageBandwidth();
+    // O(1): dibaca dari ringkasan yang diperbarui saat append
+    double getMaxBandwidth() const { return bandwidth_stats.max(); }
+    double getMinBandwidth() const { return bandwidth_stats.min(); }
+    double getAverageBandwidth() const { return bandwidth_stats.mean(); }
+    double getBandwidthStdDev() const { return bandwidth_stats.stddev(); }
+    const RunningStats& getBandwidthStats() const { return bandwidth_stats; }
     
     // Fungsi keluaran
     void displayResults();
     void exportResults(const std::string& filename);
     void printInterpolationTable();
+    void printTopFlows(size_t limit = 10);
+    void exportFlowSeries(const std::string& filename);
+    void printTopTalkers(size_t limit = 10);
+    void exportTopTalkers(const std::string& filename, size_t limit = 10);
+    // Estimasi host unik pada rentang timestamp (union sketch per interval)
+    double distinctHostsBetween(double start_time, double end_time, bool by_source) const;
+    void printDistinctHostSummary();
+    void exportIntervalSeries(const std::string& filename); // Bandwidth + host unik per interval
+    void printHourlyProfile();
+    void exportProfile(const std::string& filename);
+    // Persentil bandwidth interval (q = 0.95 untuk billing persentil ke-95)
+    double bandwidthPercentile(double q) const;
+    double bandwidthPercentileBetween(double start_time, double end_time, double q) const;
+    void printPercentiles();
+    bool saveQuantileSketches(const std::string& filename) const;
+    bool mergeQuantileSketches(const std::string& filename); // Gabung sketch link/run lain
+    // Peak prominence pada deret bandwidth resolusi penuh (prominence O(n))
+    std::vector<Peak> findBandwidthPeaks(const PeakOptions& options) const;
+    void printBandwidthPeaks(const PeakOptions& options, size_t limit = 20);
+    void exportBandwidthPeaks(const std::string& filename, const PeakOptions& options);
+    void printStreamingAnomalies(size_t limit = 20);
+    // Statistik, integral dan nilai tengah rentang [start, start + durasi)
+    // (jam sejak awal jam pertama capture) dari level rollup paling kasar yang cukup
+    void printRollupRange(double start_hours, double duration_hours, double resolution_seconds);
+    void exportStreamingAnomalies(const std::string& filename);
+    static const char* linkMetricName(uint32_t metric);
     
     // Getter
     size_t getDataSize() const { return data.size(); }
+    double getLastIngestThroughput() const { return last_ingest_mbps; } // MB/s
     const std::vector<TrafficData>& getData() const { return data; }
+    const FlowAggregator& getFlows() const { return flows; }
+    const HeavyHitterTracker& getHeavyHitters() const { return heavy_hitters; }
+    const DistinctHostTracker& getDistinctHosts() const { return distinct_hosts; }
+    const TrafficProfile& getHourlyProfile() const { return hourly_profile; }
+    const TrafficProfile& getWeeklyProfile() const { return weekly_profile; }
+    const DailyQuantileSketches& getBandwidthQuantiles() const { return bandwidth_quantiles; }
+    const InterpolationEngine& getInterpolator() const { return series_interpolator; }
+    const StreamingAnomalyDetector& getAnomalyDetector() const { return anomaly_detector; }
     
     // TAMBAHAN: Getter untuk akses protected members
-    const std::vector<double>& getBandwidth() const { return bandwidth; }
-    const std::vector<double>& getTimeHours() const { return time_hours; }
+    const SeriesColumn& getBandwidth() const { return bandwidth; }
+    const SeriesColumn& getTimeHours() const { return time_hours; }
 };
 
 #endif // NETWORK_ANALYZER_H
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "ode_forecaster.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+constexpr double ClassicRk4Tableau::C[4];
+constexpr double ClassicRk4Tableau::A[4][4];
+constexpr double ClassicRk4Tableau::B[4];
+constexpr double DormandPrinceTableau::C[7];
+constexpr double DormandPrinceTableau::A[7][7];
+constexpr double DormandPrinceTableau::B[7];
+constexpr double DormandPrinceTableau::E[7];
+constexpr double DormandPrinceTableau::D[7];
+
+DenseTrajectory::DenseTrajectory() : last_slope(0.0), floor_value(-std::numeric_limits<double>::infinity()) {}
+
+void DenseTrajectory::clear() {
+    times.clear();
+    values.clear();
+    coefficients.clear();
+}
+
+void DenseTrajectory::reserve(size_t nodes) {
+    times.reserve(nodes);
+    values.reserve(nodes);
+    coefficients.reserve(nodes * 5);
+}
+
+void DenseTrajectory::append(double t, double y, double dydt) {
+    append(t, y, dydt, 0.0);
+}
+
+void DenseTrajectory::append(double t, double y, double dydt, double fifth_coefficient) {
+    if (!times.empty()) {
+        double h = t - times.back();
+        double y0 = values.back();
+        double difference = y - y0;
+        double spline = h * last_slope - difference;
+        coefficients.push_back(y0);
+        coefficients.push_back(difference);
+        coefficients.push_back(spline);
+        coefficients.push_back(difference - h * dydt - spline);
+        coefficients.push_back(fifth_coefficient);
+    }
+    times.push_back(t);
+    values.push_back(y);
+    last_slope = dydt;
+}
+
+size_t DenseTrajectory::segmentOf(double t) const {
+    // Segmen i dengan times[i] <= t < times[i+1], dibatasi ke [0, n-2]
+    size_t upper = static_cast<size_t>(std::upper_bound(times.begin(), times.end(), t) - times.begin());
+    if (upper == 0) return 0;
+    return std::min(upper - 1, times.size() - 2);
+}
+
+double DenseTrajectory::evaluateSegment(size_t segment, double t) const {
+    const double* r = &coefficients[segment * 5];
+    double s = (t - times[segment]) / (times[segment + 1] - times[segment]);
+    double s1 = 1.0 - s;
+    double value = r[0] + s * (r[1] + s1 * (r[2] + s * (r[3] + s1 * r[4])));
+    return std::max(value, floor_value);
+}
+
+double DenseTrajectory::evaluate(double t) const {
+    if (times.empty()) return 0.0;
+    if (t <= times.front()) return values.front();
+    if (t >= times.back()) return values.back();
+    return evaluateSegment(segmentOf(t), t);
+}
+
+void DenseTrajectory::evaluate(const double* query_times, size_t count, double* results) const {
+    if (times.size() < 2) {
+        for (size_t i = 0; i < count; i++) results[i] = evaluate(query_times[i]);
+        return;
+    }
+    // Merge walk selama query naik; query mundur memicu pencarian biner
+    size_t segment = 0;
+    double previous = -std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < count; i++) {
+        double t = query_times[i];
+        if (t <= times.front() || t >= times.back()) {
+            results[i] = evaluate(t);
+        } else {
+            if (t < previous) segment = segmentOf(t);
+            while (segment + 2 < times.size() && times[segment + 1] <= t) segment++;
+            results[i] = evaluateSegment(segment, t);
+        }
+        previous = t;
+    }
+}
+
+
+const char* OdeIntegrator::methodName(OdeMethod method) {
+    switch (method) {
+        case OdeMethod::ClassicRk4: return "RK4 langkah tetap";
+        case OdeMethod::DormandPrince: return "Dormand-Prince 5(4) adaptif";
+    }
+    return "-";
+}
@@ -0,0 +1,338 @@
+#ifndef ODE_FORECASTER_H
+#define ODE_FORECASTER_H
+
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+// Trajektori hasil integrasi ODE satu kali dengan dense output. Setiap
+// segmen [t_i, t_i+1] menyimpan 5 koefisien bentuk kontinu Hairer:
+//   y(t_i + s*h) = r1 + s*(r2 + (1-s)*(r3 + s*(r4 + (1-s)*r5)))
+// r5 = 0 memberi Hermite kubik dari (y, dy/dt) di kedua ujung (RK4);
+// Dormand-Prince mengisi r5 dengan interpolant orde 4 bawaannya.
+// Query terurut dijawab dengan satu merge walk sehingga N output pada
+// trajektori M langkah berbiaya O(N + M).
+class DenseTrajectory {
+private:
+    std::vector<double> times;
+    std::vector<double> values;
+    std::vector<double> coefficients; // 5 per segmen
+    double last_slope;
+    double floor_value; // Nilai interpolasi tidak pernah di bawah batas ini
+
+    double evaluateSegment(size_t segment, double t) const;
+    size_t segmentOf(double t) const;
+
+public:
+    DenseTrajectory();
+
+    void clear();
+    void reserve(size_t nodes);
+    // Node baru; segmen dari node sebelumnya diinterpolasi Hermite kubik
+    void append(double t, double y, double dydt);
+    // Node baru dengan suku r5 interpolant kontinu (Dormand-Prince)
+    void append(double t, double y, double dydt, double fifth_coefficient);
+    void setFloor(double value) { floor_value = value; }
+
+    // Di luar [startTime, endTime] nilai ujung terdekat dikembalikan
+    double evaluate(double t) const;
+    void evaluate(const double* query_times, size_t count, double* results) const;
+
+    bool empty() const { return times.empty(); }
+    size_t size() const { return times.size(); }
+    double startTime() const { return times.empty() ? 0.0 : times.front(); }
+    double endTime() const { return times.empty() ? 0.0 : times.back(); }
+    double endValue() const { return values.empty() ? 0.0 : values.back(); }
+};
+
+// Tabel Butcher sebagai konstanta compile-time: loop tahap di
+// explicitStages() dibuka compiler dan koefisien menjadi imediat.
+struct ClassicRk4Tableau {
+    static const int STAGES = 4;
+    static constexpr double C[4] = {0.0, 0.5, 0.5, 1.0};
+    static constexpr double A[4][4] = {
+        {0.0, 0.0, 0.0, 0.0},
+        {0.5, 0.0, 0.0, 0.0},
+        {0.0, 0.5, 0.0, 0.0},
+        {0.0, 0.0, 1.0, 0.0}};
+    static constexpr double B[4] = {1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0};
+};
+
+// Dormand-Prince 5(4): B = solusi orde 5 (dipakai), E = B - B* (orde 4)
+// untuk estimasi galat; tahap ke-7 = f di ujung langkah (FSAL), sehingga
+// langkah diterima hanya butuh 6 evaluasi baru.
+struct DormandPrinceTableau {
+    static const int STAGES = 7;
+    static constexpr double C[7] = {0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0};
+    static constexpr double A[7][7] = {
+        {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        {1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        {3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0, 0.0},
+        {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0, 0.0, 0.0},
+        {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0, 0.0, 0.0},
+        {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0}};
+    static constexpr double B[7] = {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0,
+                                    -2187.0 / 6784.0, 11.0 / 84.0, 0.0};
+    static constexpr double E[7] = {71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0,
+                                    -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0};
+    // Koefisien dense output orde 4 (Hairer & Wanner, dopri5)
+    static constexpr double D[7] = {-12715105075.0 / 11282082432.0, 0.0, 87487479700.0 / 32700410799.0,
+                                    -10690763975.0 / 1880347072.0, 701980252875.0 / 199316789632.0,
+                                    -1453857185.0 / 822651844.0, 69997945.0 / 29380423.0};
+};
+
+enum class OdeMethod {
+    ClassicRk4,    // Langkah tetap 'step'
+    DormandPrince  // Langkah adaptif dengan kontrol galat 5(4)
+};
+
+struct OdeOptions {
+    OdeMethod method;
+    double step;                // RK4: langkah tetap; DP: langkah awal
+    double absolute_tolerance;  // DP: galat lokal <= atol + rtol * |y|
+    double relative_tolerance;
+    double min_step;
+    double max_step;            // DP: batas atas langkah (0 = tanpa batas)
+    size_t max_steps;
+    double floor_value;         // y dibatasi minimal nilai ini setelah setiap langkah
+
+    OdeOptions()
+        : method(OdeMethod::DormandPrince), step(0.1), absolute_tolerance(1e-8), relative_tolerance(1e-8),
+          min_step(1e-9), max_step(0.0), max_steps(10000000), floor_value(-1e300) {}
+};
+
+struct OdeStats {
+    size_t evaluations;  // Pemanggilan f(t, y)
+    size_t accepted;
+    size_t rejected;
+    bool completed;      // false jika max_steps/min_step tercapai sebelum t_end
+
+    OdeStats() : evaluations(0), accepted(0), rejected(0), completed(true) {}
+};
+
+// Integrator ODE skalar dy/dt = f(t, y) dari t0 sampai tepat t_end
+// (langkah terakhir dipendekkan, tidak pernah melewati target).
+// Model adalah functor double(double t, double y) const; dengan tipe
+// konkret (policy model di traffic_model.h, lambda) loop tahap
+// dispesialisasi dan f diinline. std::function tetap bisa dipakai.
+class OdeIntegrator {
+public:
+    typedef std::function<double(double, double)> Derivative;
+
+    template <typename Model>
+    static DenseTrajectory integrate(const Model& f, double t0, double y0, double t_end,
+                                     const OdeOptions& options, OdeStats* stats = nullptr);
+    static const char* methodName(OdeMethod method);
+
+private:
+    template <typename Tableau, typename Model>
+    static void explicitStages(const Model& f, double t, double y, double h, double* k);
+    template <typename Tableau>
+    static double weightedSum(const double (&weights)[Tableau::STAGES], const double* k);
+    template <typename Model>
+    static DenseTrajectory integrateRk4(const Model& f, double t0, double y0, double t_end,
+                                        const OdeOptions& options, OdeStats& stats);
+    template <typename Model>
+    static DenseTrajectory integrateDormandPrince(const Model& f, double t0, double y0, double t_end,
+                                                  const OdeOptions& options, OdeStats& stats);
+};
+
+// Tahap 1..STAGES-1 metode eksplisit; k[0] = f(t, y) dari pemanggil
+template <typename Tableau, typename Model>
+void OdeIntegrator::explicitStages(const Model& f, double t, double y, double h, double* k) {
+    for (int stage = 1; stage < Tableau::STAGES; stage++) {
+        double increment = 0.0;
+        for (int j = 0; j < stage; j++) increment += Tableau::A[stage][j] * k[j];
+        k[stage] = f(t + Tableau::C[stage] * h, y + h * increment);
+    }
+}
+
+template <typename Tableau>
+double OdeIntegrator::weightedSum(const double (&weights)[Tableau::STAGES], const double* k) {
+    double sum = 0.0;
+    for (int stage = 0; stage < Tableau::STAGES; stage++) sum += weights[stage] * k[stage];
+    return sum;
+}
+
+// RK4 langkah tetap dengan semantik lama: tahap memakai f apa adanya dan
+// y hanya dipotong ke floor setelah setiap langkah. DP menangani batas
+// sebagai event (mendarat + lepas).
+template <typename Model>
+DenseTrajectory OdeIntegrator::integrateRk4(const Model& f, double t0, double y0, double t_end,
+                                            const OdeOptions& options, OdeStats& stats) {
+    DenseTrajectory trajectory;
+    trajectory.setFloor(options.floor_value);
+    size_t steps = static_cast<size_t>(std::ceil((t_end - t0) / options.step - 1e-9));
+    if (steps > options.max_steps) {
+        steps = options.max_steps;
+        stats.completed = false;
+    }
+    trajectory.reserve(steps + 1);
+
+    double t = t0, y = y0;
+    double k[ClassicRk4Tableau::STAGES];
+    k[0] = f(t, y);
+    stats.evaluations++;
+    trajectory.append(t, y, k[0]);
+    for (size_t i = 0; i < steps; i++) {
+        // Langkah terakhir dipotong agar tepat berakhir di t_end
+        double h = std::min(options.step, t_end - t);
+        explicitStages<ClassicRk4Tableau>(f, t, y, h, k);
+        y += h * weightedSum<ClassicRk4Tableau>(ClassicRk4Tableau::B, k);
+        t = (i + 1 == steps && stats.completed) ? t_end : t0 + static_cast<double>(i + 1) * options.step;
+        if (y < options.floor_value) y = options.floor_value;
+        k[0] = f(t, y);
+        stats.evaluations += ClassicRk4Tableau::STAGES;
+        stats.accepted++;
+        trajectory.append(t, y, k[0]);
+    }
+    return trajectory;
+}
+
+template <typename Model>
+DenseTrajectory OdeIntegrator::integrateDormandPrince(const Model& f, double t0, double y0, double t_end,
+                                                      const OdeOptions& options, OdeStats& stats) {
+    typedef DormandPrinceTableau DP;
+    DenseTrajectory trajectory;
+    trajectory.setFloor(options.floor_value);
+
+    double t = t0, y = y0;
+    double k[DP::STAGES];
+    k[0] = f(t, y);
+    stats.evaluations++;
+    trajectory.append(t, y, k[0]);
+
+    double span = t_end - t0;
+    double max_step = options.max_step > 0.0 ? options.max_step : span;
+    double initial_step = options.step > 0.0 ? options.step : span / 100.0;
+    double h = std::min(initial_step, max_step);
+    // Resolusi bisection titik lepas; tetap positif walau min_step <= 0
+    double release_resolution = std::max(options.min_step, 4.0 * std::numeric_limits<double>::epsilon());
+    const double SAFETY = 0.9, MIN_FACTOR = 0.2, MAX_FACTOR = 10.0;
+
+    bool landing = false; // Langkah sedang diarahkan ke titik potong batas
+    while (t < t_end) {
+        if (y <= options.floor_value && k[0] <= 0.0) {
+            // Menempel di batas: y konstan sampai f(t, floor) > 0. Waktu
+            // lepas dicari langsung (langkah probe + bisection) karena
+            // tekukan di titik lepas tidak terlihat oleh estimasi galat
+            // DP dan langkah besar bisa melompatinya.
+            double low = t, high = t, probe = initial_step;
+            bool released = false;
+            while (!released && high < t_end) {
+                low = high;
+                high = std::min(low + probe, t_end);
+                released = f(high, y) > 0.0;
+                stats.evaluations++;
+                probe = std::min(probe * 2.0, 10.0 * initial_step);
+            }
+            if (!released) {
+                trajectory.append(t_end, y, 0.0);
+                stats.accepted++;
+                break;
+            }
+            while (high - low > release_resolution * std::max(1.0, std::fabs(high))) {
+                double middle = 0.5 * (low + high);
+                if (f(middle, y) > 0.0) high = middle;
+                else low = middle;
+                stats.evaluations++;
+            }
+            if (low > t) trajectory.append(low, y, 0.0);
+            t = high;
+            k[0] = f(t, y);
+            stats.evaluations++;
+            trajectory.append(t, y, k[0]);
+            stats.accepted++;
+            h = std::min(initial_step, max_step);
+            continue;
+        }
+        if (stats.accepted + stats.rejected >= options.max_steps || h < options.min_step) {
+            stats.completed = false;
+            break;
+        }
+        bool last = t + h >= t_end;
+        if (last) h = t_end - t;
+
+        explicitStages<DP>(f, t, y, h, k);
+        stats.evaluations += DP::STAGES - 1;
+        double y_new = y + h * weightedSum<DP>(DP::B, k);
+        double error = h * weightedSum<DP>(DP::E, k);
+        double scale = options.absolute_tolerance + options.relative_tolerance * std::max(std::fabs(y), std::fabs(y_new));
+        double ratio = std::fabs(error) / scale;
+
+        // Kontrol langkah standar: h_baru = h * 0.9 * ratio^(-1/5)
+        double factor = ratio > 0.0 ? SAFETY * std::pow(ratio, -0.2) : MAX_FACTOR;
+        factor = std::max(MIN_FACTOR, std::min(MAX_FACTOR, factor));
+        if (!(ratio <= 1.0)) {
+            stats.rejected++;
+            landing = false;
+            h *= std::min(factor, 1.0);
+            continue;
+        }
+
+        double fifth = h * weightedSum<DP>(DP::D, k);
+        if (y_new < options.floor_value && !landing) {
+            // Langkah menembus batas: titik potong dicari pada interpolant
+            // kontinu (tanpa evaluasi f), lalu langkah diulang tepat ke sana
+            double difference = y_new - y;
+            double spline = h * k[0] - difference;
+            double r4 = difference - h * k[DP::STAGES - 1] - spline;
+            double low = 0.0, high = 1.0;
+            for (int iteration = 0; iteration < 50; iteration++) {
+                double s = 0.5 * (low + high), s1 = 1.0 - s;
+                double value = y + s * (difference + s1 * (spline + s * (r4 + s1 * fifth)));
+                if (value > options.floor_value) low = s;
+                else high = s;
+            }
+            if (high * h >= options.min_step) {
+                h *= high;
+                landing = true;
+                continue;
+            }
+        }
+
+        double t_new = last ? t_end : t + h;
+        double slope = k[DP::STAGES - 1]; // FSAL: f(t_new, y_new)
+        if (landing || y_new < options.floor_value) {
+            // Mendarat di batas: sisa galat interpolasi dipotong ke floor
+            y_new = options.floor_value;
+            slope = f(t_new, y_new);
+            stats.evaluations++;
+            fifth = 0.0;
+            landing = false;
+        }
+        trajectory.append(t_new, y_new, slope, fifth);
+        stats.accepted++;
+        t = t_new;
+        y = y_new;
+        k[0] = slope;
+        h = std::min(h * factor, max_step);
+    }
+    return trajectory;
+}
+
+
+template <typename Model>
+DenseTrajectory OdeIntegrator::integrate(const Model& f, double t0, double y0, double t_end,
+                                         const OdeOptions& options, OdeStats* stats) {
+    OdeStats local;
+    OdeStats& result = stats ? *stats : local;
+    result = OdeStats();
+
+    bool fixed = options.method == OdeMethod::ClassicRk4;
+    if (!(t_end > t0) || (fixed && !(options.step > 0.0))) {
+        DenseTrajectory trajectory;
+        trajectory.setFloor(options.floor_value);
+        trajectory.append(t0, y0, f(t0, y0));
+        result.evaluations = 1;
+        return trajectory;
+    }
+    return fixed ? integrateRk4(f, t0, y0, t_end, options, result)
+                 : integrateDormandPrince(f, t0, y0, t_end, options, result);
+}
+
+#endif // ODE_FORECASTER_H
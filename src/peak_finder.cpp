@@ -0,0 +1,212 @@
+#include "peak_finder.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+struct StackEntry {
+    double value;
+    double gap_min;       // Minimum antara entri ini dan entri di atasnya
+    size_t gap_min_index;
+};
+
+// Deret dipadatkan menjadi lembah-peak-lembah-...-peak-lembah: titik
+// pertama yang lebih tinggi dari sebuah peak selalu dicapai lewat maksimum
+// lokal yang lebih tinggi, dan minimum di antaranya ada di salah satu
+// lembah, sehingga prominence cukup dihitung atas ~2 titik per peak.
+struct Terrain {
+    std::vector<double> values;        // Posisi genap = lembah, ganjil = peak
+    std::vector<size_t> first_index;   // Indeks asli (minimum pertama di lembah)
+    std::vector<size_t> last_index;    // Minimum terakhir di lembah
+};
+
+// Satu lintasan: deteksi maksimum lokal (tengah plateau) sekaligus
+// minimum lembah di antaranya. Nilai plateau sama dengan tinggi peak
+// sehingga dilewati tanpa memengaruhi minimum lembah.
+void scanTerrain(const double* y, size_t n, std::vector<size_t>& peaks, Terrain& terrain) {
+    peaks.clear();
+    terrain.values.clear();
+    terrain.first_index.clear();
+    terrain.last_index.clear();
+    if (n < 3) return;
+    size_t capacity = n / 2 + 2;
+    peaks.reserve(capacity);
+    terrain.values.reserve(2 * capacity);
+    terrain.first_index.reserve(2 * capacity);
+    terrain.last_index.reserve(2 * capacity);
+
+    double minimum = y[0];
+    size_t first = 0, last = 0;
+    size_t i = 1;
+    while (i + 1 < n) {
+        double value = y[i];
+        if (y[i - 1] < value && value >= y[i + 1]) {
+            size_t ahead = i + 1;
+            while (ahead + 1 < n && y[ahead] == value) ahead++;
+            if (y[ahead] < value) {
+                size_t peak = (i + ahead - 1) / 2;
+                peaks.push_back(peak);
+                terrain.values.push_back(minimum);
+                terrain.first_index.push_back(first);
+                terrain.last_index.push_back(last);
+                terrain.values.push_back(value);
+                terrain.first_index.push_back(peak);
+                terrain.last_index.push_back(peak);
+                // Lembah berikutnya dimulai dari titik turun pertama
+                minimum = y[ahead];
+                first = last = ahead;
+                i = ahead + 1;
+                continue;
+            }
+            i = ahead;
+            continue;
+        }
+        // Pilih-kondisional (cmov): pada data bising cabang sering salah tebak
+        bool lower = value < minimum;
+        first = lower ? i : first;
+        last = (value <= minimum) ? i : last;
+        minimum = lower ? value : minimum;
+        i++;
+    }
+    for (; i < n; i++) {
+        if (y[i] < minimum) {
+            minimum = y[i];
+            first = last = i;
+        } else if (y[i] == minimum) {
+            last = i;
+        }
+    }
+    terrain.values.push_back(minimum);
+    terrain.first_index.push_back(first);
+    terrain.last_index.push_back(last);
+}
+
+// Base satu sisi untuk setiap peak: minimum antara peak dan titik pertama
+// yang lebih tinggi ke arah pemindaian, atau sampai ujung deret.
+// forward = true memindai kiri->kanan (base kiri).
+void computeBases(const Terrain& terrain, bool forward, std::vector<size_t>& bases) {
+    const std::vector<double>& values = terrain.values;
+    // Minimum terdekat dengan peak: yang terakhir di lembah kiri, pertama di kanan
+    const std::vector<size_t>& nearest = forward ? terrain.last_index : terrain.first_index;
+    size_t n = values.size();
+    bases.assign(n / 2, 0);
+    std::vector<StackEntry> stack;
+    stack.reserve(64);
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // Minimum sejak ujung deret (dipakai jika tidak ada titik lebih tinggi)
+    double edge_min = infinity;
+    size_t edge_min_index = 0;
+
+    for (size_t step = 0; step < n; step++) {
+        size_t i = forward ? step : n - 1 - step;
+        double value = values[i];
+
+        // Titik yang tidak lebih tinggi dari values[i] tertutupi: lipat
+        // minimum celahnya ke entri di bawahnya. Celah yang dilipat lebih
+        // dekat ke posisi sekarang, jadi menang bila nilainya seri (base =
+        // minimum terdekat dengan peak)
+        double carry = infinity;
+        size_t carry_index = 0;
+        while (!stack.empty() && stack.back().value <= value) {
+            if (stack.back().gap_min < carry) {
+                carry = stack.back().gap_min;
+                carry_index = stack.back().gap_min_index;
+            }
+            stack.pop_back();
+        }
+        if (!stack.empty() && carry <= stack.back().gap_min) {
+            stack.back().gap_min = carry;
+            stack.back().gap_min_index = carry_index;
+        }
+
+        if (i % 2 == 1) {
+            bases[i / 2] = stack.empty() ? edge_min_index : stack.back().gap_min_index;
+        }
+
+        // values[i] menjadi bagian celah entri teratas, lalu i didorong
+        if (!stack.empty() && value <= stack.back().gap_min) {
+            stack.back().gap_min = value;
+            stack.back().gap_min_index = nearest[i];
+        }
+        if (value <= edge_min) {
+            edge_min = value;
+            edge_min_index = nearest[i];
+        }
+        StackEntry entry;
+        entry.value = value;
+        entry.gap_min = infinity;
+        entry.gap_min_index = 0;
+        stack.push_back(entry);
+    }
+}
+
+} // namespace
+
+std::vector<Peak> PeakFinder::find(const double* y, size_t n, const PeakOptions& options) {
+    std::vector<Peak> result;
+    std::vector<size_t> candidates;
+    Terrain terrain;
+    scanTerrain(y, n, candidates, terrain);
+    if (candidates.empty()) return result;
+
+    std::vector<size_t> left_bases, right_bases;
+    computeBases(terrain, true, left_bases);
+    computeBases(terrain, false, right_bases);
+
+    std::vector<Peak> peaks;
+    peaks.reserve(candidates.size());
+    for (size_t c = 0; c < candidates.size(); c++) {
+        size_t p = candidates[c];
+        Peak peak;
+        peak.index = p;
+        peak.height = y[p];
+        peak.left_base = left_bases[c];
+        peak.right_base = right_bases[c];
+        peak.prominence = y[p] - std::max(y[peak.left_base], y[peak.right_base]);
+        if (peak.height < options.min_height || peak.prominence < options.min_prominence) continue;
+        peaks.push_back(peak);
+    }
+
+    // Jarak minimum: peak tertinggi dipertahankan lebih dulu
+    if (options.min_distance > 1 && peaks.size() > 1) {
+        std::vector<size_t> order(peaks.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&peaks](size_t a, size_t b) {
+            return peaks[a].height > peaks[b].height;
+        });
+        std::vector<char> keep(peaks.size(), 1);
+        for (size_t rank = 0; rank < order.size(); rank++) {
+            size_t current = order[rank];
+            if (!keep[current]) continue;
+            // Tetangga yang lebih rendah dalam jarak terlarang dibuang
+            for (size_t k = current; k-- > 0 && peaks[current].index - peaks[k].index < options.min_distance;) keep[k] = 0;
+            for (size_t k = current + 1; k < peaks.size() && peaks[k].index - peaks[current].index < options.min_distance; k++) keep[k] = 0;
+        }
+        size_t kept = 0;
+        for (size_t i = 0; i < peaks.size(); i++) {
+            if (keep[i]) peaks[kept++] = peaks[i];
+        }
+        peaks.resize(kept);
+    }
+
+    // Lebar pada tinggi evaluasi, dengan interpolasi linear di perpotongan
+    // (jalan linear per peak, lihat catatan kompleksitas di header)
+    for (Peak& peak : peaks) {
+        double level = peak.height - options.rel_height * peak.prominence;
+        size_t i = peak.index;
+        while (i > peak.left_base && y[i] > level) i--;
+        peak.left_edge = static_cast<double>(i);
+        if (y[i] < level && y[i + 1] != y[i]) {
+            peak.left_edge += (level - y[i]) / (y[i + 1] - y[i]);
+        }
+        i = peak.index;
+        while (i < peak.right_base && y[i] > level) i++;
+        peak.right_edge = static_cast<double>(i);
+        if (y[i] < level && y[i - 1] != y[i]) {
+            peak.right_edge -= (level - y[i]) / (y[i - 1] - y[i]);
+        }
+        peak.width = peak.right_edge - peak.left_edge;
+    }
+    return peaks;
+}
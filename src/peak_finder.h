@@ -0,0 +1,45 @@
+#ifndef PEAK_FINDER_H
+#define PEAK_FINDER_H
+
+#include <vector>
+#include <cstddef>
+
+struct PeakOptions {
+    double min_prominence;  // Peak dengan prominence lebih kecil dibuang
+    double min_height;      // Tinggi minimum absolut
+    size_t min_distance;    // Jarak minimum antar peak (sampel); yang lebih rendah dibuang
+    double rel_height;      // Lebar diukur pada y - rel_height * prominence (0.5 = FWHM)
+
+    PeakOptions() : min_prominence(0.0), min_height(-1e300), min_distance(1), rel_height(0.5) {}
+};
+
+struct Peak {
+    size_t index;        // Posisi puncak (tengah plateau jika datar)
+    double height;
+    double prominence;   // Tinggi di atas base tertinggi dari kedua sisi
+    size_t left_base;    // Minimum antara peak dan titik lebih tinggi terdekat di kiri
+    size_t right_base;
+    double left_edge;    // Perpotongan kiri/kanan pada tinggi evaluasi (indeks pecahan)
+    double right_edge;
+    double width;        // right_edge - left_edge, dalam sampel
+};
+
+// Pencari peak topografis. Prominence setiap maksimum lokal dihitung
+// dalam O(n) dengan dua lintasan monotone stack (kiri->kanan dan
+// kanan->kiri): stack menyimpan titik yang belum "tertutupi" titik lebih
+// tinggi beserta minimum di antara titik-titik itu, sehingga base kiri
+// setiap peak = minimum sejak titik lebih tinggi terdekat, tanpa
+// memindai ulang deret.
+//
+// Lebar dicari dengan berjalan dari peak ke arah base masing-masing sampai
+// memotong tinggi evaluasi, jadi biayanya sebanding dengan total panjang
+// jalan itu: O(n) untuk peak yang tidak bersarang, tetapi bisa mendekati
+// O(n x jumlah peak) bila banyak peak lebar saling melingkupi (peak tinggi
+// berjalan melewati peak kecil di dalamnya). Prominence tetap O(n).
+class PeakFinder {
+public:
+    // y sembarang panjang; hasil terurut menurut indeks
+    static std::vector<Peak> find(const double* y, size_t n, const PeakOptions& options = PeakOptions());
+};
+
+#endif // PEAK_FINDER_H
@@ -0,0 +1,166 @@
+#include "rollup_pyramid.h"
+#include <cmath>
+#include <algorithm>
+
+const double RollupPyramid::LEVEL_WIDTHS[RollupPyramid::LEVEL_COUNT] = {
+    1.0, 60.0, 300.0, 3600.0, 86400.0
+};
+const int64_t RollupPyramid::MAX_BASE_SPAN;
+
+// Pembagian bulat ke bawah (juga benar untuk bilangan negatif)
+static int64_t floorDiv(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) --q;
+    return q;
+}
+
+static bool isAligned(double t, double width) {
+    double k = t / width;
+    return std::fabs(k - std::floor(k + 0.5)) < 1e-6;
+}
+
+void RollupPyramid::build(const TrafficAggregate& base) {
+    levels.clear();
+    if (base.empty()) return;
+
+    // Level 0 disalin dari agregat dasar 1 detik (origin = epoch)
+    Level level0;
+    level0.width = LEVEL_WIDTHS[0];
+    level0.base_id = static_cast<int64_t>(std::floor(base.bucketStart(0) / level0.width + 0.5));
+    level0.bytes.resize(base.bucketCount());
+    level0.packets.resize(base.bucketCount());
+    for (size_t i = 0; i < base.bucketCount(); i++) {
+        level0.bytes[i] = base.bucketBytes(i);
+        level0.packets[i] = base.bucketPackets(i);
+    }
+    levels.push_back(level0);
+
+    // Level berikutnya = jumlah 'factor' bucket berurutan dari level di bawahnya
+    for (int l = 1; l < LEVEL_COUNT; l++) {
+        const Level& fine = levels.back();
+        int64_t factor = static_cast<int64_t>(LEVEL_WIDTHS[l] / fine.width + 0.5);
+        int64_t fine_last = fine.base_id + static_cast<int64_t>(fine.bytes.size()) - 1;
+
+        Level coarse;
+        coarse.width = LEVEL_WIDTHS[l];
+        coarse.base_id = floorDiv(fine.base_id, factor);
+        size_t count = static_cast<size_t>(floorDiv(fine_last, factor) - coarse.base_id + 1);
+        coarse.bytes.assign(count, 0);
+        coarse.packets.assign(count, 0);
+
+        for (size_t i = 0; i < fine.bytes.size(); i++) {
+            int64_t id = fine.base_id + static_cast<int64_t>(i);
+            size_t index = static_cast<size_t>(floorDiv(id, factor) - coarse.base_id);
+            coarse.bytes[index] += fine.bytes[i];
+            coarse.packets[index] += fine.packets[i];
+        }
+        levels.push_back(coarse);
+    }
+}
+
+int RollupPyramid::selectLevel(double start, double end, double resolution) const {
+    for (int l = static_cast<int>(levels.size()) - 1; l > 0; l--) {
+        double width = levels[l].width;
+        if (width <= resolution * (1 + 1e-9) && isAligned(start, width) && isAligned(end, width)) {
+            return l;
+        }
+    }
+    return 0;
+}
+
+void RollupPyramid::bucketRange(const Level& level, double start, double end, size_t& first, size_t& last) const {
+    int64_t first_id = static_cast<int64_t>(std::floor(start / level.width + 1e-9));
+    int64_t end_id = static_cast<int64_t>(std::ceil(end / level.width - 1e-9));
+    int64_t level_end = level.base_id + static_cast<int64_t>(level.bytes.size());
+
+    first_id = std::max(first_id, level.base_id);
+    end_id = std::min(end_id, level_end);
+    if (end_id <= first_id) {
+        first = last = 0;
+        return;
+    }
+    first = static_cast<size_t>(first_id - level.base_id);
+    last = static_cast<size_t>(end_id - level.base_id);
+}
+
+RollupRangeStats RollupPyramid::statistics(double start, double end, double resolution) const {
+    RollupRangeStats stats = {0.0, 0, 0.0, 0.0, 0.0, 0, 0};
+    if (levels.empty()) return stats;
+
+    const Level& level = levels[selectLevel(start, end, resolution)];
+    size_t first, last;
+    bucketRange(level, start, end, first, last);
+
+    stats.resolution = level.width;
+    stats.samples = last - first;
+    if (stats.samples == 0) return stats;
+
+    stats.min_mbps = level.bandwidthAt(first);
+    stats.max_mbps = stats.min_mbps;
+    for (size_t i = first; i < last; i++) {
+        double bw = level.bandwidthAt(i);
+        stats.min_mbps = std::min(stats.min_mbps, bw);
+        stats.max_mbps = std::max(stats.max_mbps, bw);
+        stats.total_bytes += level.bytes[i];
+        stats.total_packets += level.packets[i];
+    }
+    stats.mean_mbps = stats.total_bytes * 8.0 / (stats.samples * level.width * 1e6);
+    return stats;
+}
+
+double RollupPyramid::simpsonIntegration(double start, double end, double resolution) const {
+    if (levels.empty()) return 0.0;
+
+    const Level& level = levels[selectLevel(start, end, resolution)];
+    size_t first, last;
+    bucketRange(level, start, end, first, last);
+
+    if (last == first) return 0.0;
+
+    // Sampel berada di tengah bucket; setengah bucket di kedua ujung
+    // ditutup dengan nilai sampel terdekat agar seluruh [start, end) tercakup
+    double h = level.width / 3600.0; // Jarak antar sampel dalam jam
+    size_t n = last - first - 1;     // Jumlah sub-interval antar sampel
+    double integral = 0.5 * h * (level.bandwidthAt(first) + level.bandwidthAt(last - 1));
+    if (n == 0) return integral;
+
+    // Simpson 1/3 untuk jumlah sub-interval genap; sisa 3 sub-interval
+    // terakhir memakai Simpson 3/8 agar tidak ada interval yang terbuang
+    size_t simpson_end = (n % 2 == 0) ? n : (n >= 3 ? n - 3 : 0);
+    if (simpson_end > 0) {
+        double sum = level.bandwidthAt(first) + level.bandwidthAt(first + simpson_end);
+        for (size_t i = 1; i < simpson_end; i++) {
+            sum += (i % 2 == 1 ? 4.0 : 2.0) * level.bandwidthAt(first + i);
+        }
+        integral += sum * h / 3.0;
+    }
+    if (n % 2 == 1) {
+        if (n >= 3) {
+            size_t i = first + simpson_end;
+            integral += 3.0 * h / 8.0 * (level.bandwidthAt(i) + 3.0 * level.bandwidthAt(i + 1) +
+                                         3.0 * level.bandwidthAt(i + 2) + level.bandwidthAt(i + 3));
+        } else {
+            integral += h / 2.0 * (level.bandwidthAt(first) + level.bandwidthAt(first + 1));
+        }
+    }
+    return integral;
+}
+
+double RollupPyramid::interpolate(double timestamp, double resolution) const {
+    if (levels.empty()) return 0.0;
+
+    // Untuk titik tunggal hanya resolusi yang menentukan level
+    int l = static_cast<int>(levels.size()) - 1;
+    while (l > 0 && levels[l].width > resolution * (1 + 1e-9)) l--;
+    const Level& level = levels[l];
+
+    // Sampel diletakkan di tengah bucket
+    double position = timestamp / level.width - 0.5 - static_cast<double>(level.base_id);
+    double last_index = static_cast<double>(level.bytes.size() - 1);
+    if (position <= 0.0) return level.bandwidthAt(0);
+    if (position >= last_index) return level.bandwidthAt(level.bytes.size() - 1);
+
+    size_t i = static_cast<size_t>(position);
+    double frac = position - static_cast<double>(i);
+    return level.bandwidthAt(i) + (level.bandwidthAt(i + 1) - level.bandwidthAt(i)) * frac;
+}
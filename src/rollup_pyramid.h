@@ -0,0 +1,74 @@
+#ifndef ROLLUP_PYRAMID_H
+#define ROLLUP_PYRAMID_H
+
+#include "traffic_aggregator.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Statistik rentang waktu yang dijawab dari satu level piramida
+struct RollupRangeStats {
+    double resolution;     // Lebar bucket level yang dipakai (detik)
+    size_t samples;        // Jumlah bucket dalam rentang
+    double mean_mbps;
+    double min_mbps;
+    double max_mbps;
+    int64_t total_bytes;
+    int64_t total_packets;
+};
+
+// Piramida rollup multi-resolusi: 1 detik, 1 menit, 5 menit, 1 jam, 1 hari.
+// Level dasar (1 detik) diisi saat ingest; setiap level di atasnya diturunkan
+// dari level di bawahnya. Bucket disejajarkan ke epoch Unix sehingga level
+// harian dimulai tepat tengah malam UTC. Query memilih level paling kasar
+// yang masih memenuhi rentang dan resolusi yang diminta.
+//
+// Level dasar padat per detik, jadi rentangnya dibatasi MAX_BASE_SPAN
+// (31 hari, ~43 MB counter); paket di luar rentang itu tidak masuk piramida.
+class RollupPyramid {
+public:
+    static const int LEVEL_COUNT = 5;
+    static const double LEVEL_WIDTHS[LEVEL_COUNT];
+    static const int64_t MAX_BASE_SPAN = 31 * 86400; // Bucket 1 detik
+
+    struct Level {
+        double width;    // Lebar bucket (detik)
+        int64_t base_id; // Nomor bucket (sejak epoch) untuk indeks 0
+        std::vector<int64_t> bytes;
+        std::vector<int64_t> packets;
+
+        double bandwidthAt(size_t index) const {
+            return bytes[index] * 8.0 / (width * 1e6);
+        }
+    };
+
+private:
+    std::vector<Level> levels;
+
+    // Rentang indeks bucket [first, last) level untuk [start, end)
+    void bucketRange(const Level& level, double start, double end, size_t& first, size_t& last) const;
+
+public:
+    // Agregat dasar yang harus dipakai ingest untuk mengisi level 0
+    static TrafficAggregate makeBaseAggregate() { return TrafficAggregate(0.0, LEVEL_WIDTHS[0], MAX_BASE_SPAN); }
+
+    // Bangun seluruh level dari agregat dasar 1 detik
+    void build(const TrafficAggregate& base);
+    void clear() { levels.clear(); }
+    bool empty() const { return levels.empty(); }
+
+    const Level& getLevel(int index) const { return levels[index]; }
+    int levelCount() const { return static_cast<int>(levels.size()); }
+    double startTime() const { return levels.empty() ? 0.0 : levels[0].base_id * levels[0].width; }
+
+    // Level paling kasar dengan lebar <= resolution yang batas bucket-nya
+    // sejajar dengan start dan end. Jatuh ke level 0 jika tidak ada.
+    int selectLevel(double start, double end, double resolution) const;
+
+    // Query rentang waktu (timestamp Unix, detik)
+    RollupRangeStats statistics(double start, double end, double resolution) const;
+    double simpsonIntegration(double start, double end, double resolution) const; // Mbps×jam
+    double interpolate(double timestamp, double resolution) const;                // Mbps
+};
+
+#endif // ROLLUP_PYRAMID_H
@@ -0,0 +1,72 @@
+#ifndef RUNNING_STATS_H
+#define RUNNING_STATS_H
+
+#include <cstddef>
+#include <cmath>
+
+// Ringkasan statistik yang diperbarui setiap kali sampel ditambahkan:
+// count, sum, min, max, serta mean/varians dengan algoritma Welford
+// (stabil secara numerik, tanpa menyimpan sampel). Semua getter O(1).
+// Dua ringkasan bisa digabung (Chan dkk.) untuk agregasi paralel.
+class RunningStats {
+private:
+    size_t n;
+    double total;
+    double running_mean;
+    double m2; // Jumlah kuadrat selisih terhadap mean
+    double minimum;
+    double maximum;
+
+public:
+    RunningStats() { clear(); }
+
+    void clear() {
+        n = 0;
+        total = 0.0;
+        running_mean = 0.0;
+        m2 = 0.0;
+        minimum = 0.0;
+        maximum = 0.0;
+    }
+
+    void add(double value) {
+        n++;
+        total += value;
+        double delta = value - running_mean;
+        running_mean += delta / static_cast<double>(n);
+        m2 += delta * (value - running_mean);
+        if (n == 1 || value < minimum) minimum = value;
+        if (n == 1 || value > maximum) maximum = value;
+    }
+
+    void merge(const RunningStats& other) {
+        if (other.n == 0) return;
+        if (n == 0) {
+            *this = other;
+            return;
+        }
+        double combined = static_cast<double>(n + other.n);
+        double delta = other.running_mean - running_mean;
+        m2 += other.m2 + delta * delta * static_cast<double>(n) * static_cast<double>(other.n) / combined;
+        running_mean += delta * static_cast<double>(other.n) / combined;
+        total += other.total;
+        n += other.n;
+        if (other.minimum < minimum) minimum = other.minimum;
+        if (other.maximum > maximum) maximum = other.maximum;
+    }
+
+    size_t count() const { return n; }
+    bool empty() const { return n == 0; }
+    double sum() const { return total; }
+    // Mean dari sum/count (sama persis dengan rata-rata hasil scan);
+    // mean Welford hanya dipakai untuk akumulasi varians
+    double mean() const { return n > 0 ? total / static_cast<double>(n) : 0.0; }
+    double min() const { return minimum; }
+    double max() const { return maximum; }
+    // Varians populasi (pembagi n) dan sampel (pembagi n - 1)
+    double variance() const { return n > 0 ? m2 / static_cast<double>(n) : 0.0; }
+    double sampleVariance() const { return n > 1 ? m2 / static_cast<double>(n - 1) : 0.0; }
+    double stddev() const { return std::sqrt(variance()); }
+};
+
+#endif // RUNNING_STATS_H
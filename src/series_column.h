@@ -0,0 +1,68 @@
+#ifndef SERIES_COLUMN_H
+#define SERIES_COLUMN_H
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+// Kolom deret double yang memiliki datanya sendiri atau hanya menunjuk ke
+// memori milik objek lain (mis. kolom file .ntcol yang dipetakan). Mode view
+// menyimpan shared_ptr ke pemilik memori sehingga pemetaan tetap hidup
+// selama kolom dipakai. Penulisan pertama (push_back) pada view menyalin
+// isinya ke vektor sendiri lebih dulu (copy-on-write).
+class SeriesColumn {
+private:
+    std::vector<double> owned;
+    const double* view;                 // nullptr = mode milik sendiri
+    size_t view_count;
+    std::shared_ptr<const void> keeper; // Pemilik memori view
+
+    void materialize() {
+        if (view == nullptr) return;
+        owned.assign(view, view + view_count);
+        view = nullptr;
+        view_count = 0;
+        keeper.reset();
+    }
+
+public:
+    SeriesColumn() : view(nullptr), view_count(0) {}
+
+    // Tampilkan 'count' nilai di 'values' tanpa menyalin; 'owner' menjaga
+    // memori tetap valid
+    void assignView(const double* values, size_t count, const std::shared_ptr<const void>& owner) {
+        owned.clear();
+        owned.shrink_to_fit();
+        view = values;
+        view_count = count;
+        keeper = owner;
+    }
+
+    bool isView() const { return view != nullptr; }
+
+    const double* data() const { return view ? view : owned.data(); }
+    size_t size() const { return view ? view_count : owned.size(); }
+    bool empty() const { return size() == 0; }
+    double operator[](size_t index) const { return data()[index]; }
+    double back() const { return data()[size() - 1]; }
+    const double* begin() const { return data(); }
+    const double* end() const { return data() + size(); }
+    std::vector<double> toVector() const { return std::vector<double>(begin(), end()); }
+
+    void clear() {
+        owned.clear();
+        view = nullptr;
+        view_count = 0;
+        keeper.reset();
+    }
+    void reserve(size_t count) {
+        materialize();
+        owned.reserve(count);
+    }
+    void push_back(double value) {
+        materialize();
+        owned.push_back(value);
+    }
+};
+
+#endif // SERIES_COLUMN_H
@@ -0,0 +1,84 @@
+#include "traffic_aggregator.h"
+#include <algorithm>
+
+constexpr double TrafficAggregate::MIN_INTERVAL;
+constexpr double TrafficAggregate::MAX_INTERVAL;
+constexpr int64_t TrafficAggregate::MAX_SPAN_BUCKETS;
+constexpr double TrafficAggregate::MAX_OFFSET;
+constexpr int64_t TrafficAggregate::INVALID_ID;
+
+TrafficAggregate::TrafficAggregate(double origin_time, double interval_seconds, int64_t max_span_buckets)
+    : origin(origin_time), interval_duration(interval_seconds), inv_interval(1.0 / interval_seconds),
+      storage_id(0), first_id(0), max_span(max_span_buckets), outliers(0) {}
+
+bool TrafficAggregate::growTo(int64_t interval_id) {
+    if (bytes.empty()) {
+        storage_id = first_id = interval_id;
+        bytes.assign(1, 0);
+        packets.assign(1, 0);
+        return true;
+    }
+
+    // Rentang dihitung unsigned: id bisa sejauh +-2^62 sehingga selisihnya
+    // melampaui int64
+    int64_t last_id = storage_id + static_cast<int64_t>(bytes.size()) - 1;
+    uint64_t span = static_cast<uint64_t>(std::max(last_id, interval_id)) -
+                    static_cast<uint64_t>(std::min(first_id, interval_id));
+    if (span >= static_cast<uint64_t>(max_span)) return false;
+
+    if (interval_id < first_id) {
+        if (interval_id < storage_id) {
+            // Paket sebelum bucket pertama (capture tidak terurut): tambah
+            // cadangan depan minimal sebanyak data saat ini (penggandaan)
+            size_t shift = static_cast<size_t>(storage_id - interval_id);
+            size_t grow = std::max(shift, bytes.size());
+            grow = std::min(grow, static_cast<size_t>(max_span));
+            bytes.insert(bytes.begin(), grow, 0);
+            packets.insert(packets.begin(), grow, 0);
+            storage_id -= static_cast<int64_t>(grow);
+        }
+        first_id = interval_id;
+        return true;
+    }
+
+    size_t needed = static_cast<size_t>(interval_id - storage_id) + 1;
+    if (needed > bytes.size()) {
+        bytes.resize(needed, 0);
+        packets.resize(needed, 0);
+    }
+    return true;
+}
+
+void TrafficAggregate::merge(const TrafficAggregate& other) {
+    outliers += other.outliers;
+    if (other.empty()) return;
+
+    // Perluas rentang agar mencakup kedua agregat bila masih dalam batas;
+    // bucket lain yang tetap di luar rentang dihitung sebagai outlier
+    int64_t other_last = other.first_id + static_cast<int64_t>(other.bucketCount()) - 1;
+    growTo(other.first_id);
+    growTo(other_last);
+
+    int64_t last_id = storage_id + static_cast<int64_t>(bytes.size()) - 1;
+    for (size_t i = 0; i < other.bucketCount(); i++) {
+        int64_t id = other.bucketIntervalId(i);
+        if (id < first_id || id > last_id) {
+            if (!growTo(id)) {
+                outliers += other.bucketPackets(i);
+                continue;
+            }
+            last_id = storage_id + static_cast<int64_t>(bytes.size()) - 1;
+        }
+        size_t index = static_cast<size_t>(id - storage_id);
+        bytes[index] += other.bucketBytes(i);
+        packets[index] += other.bucketPackets(i);
+    }
+}
+
+int64_t TrafficAggregate::totalPackets() const {
+    int64_t total = 0;
+    for (int64_t count : packets) {
+        total += count;
+    }
+    return total;
+}
@@ -0,0 +1,104 @@
+#ifndef TRAFFIC_AGGREGATOR_H
+#define TRAFFIC_AGGREGATOR_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+// Agregat per interval dengan bucket kontigu yang diindeks langsung:
+// indeks = interval_id - storage_id. Biaya per paket hanya beberapa operasi
+// aritmetika (tanpa lookup tree). Counter byte dan paket 64-bit sehingga
+// tidak overflow di link sibuk. Setiap thread ingest memiliki satu objek
+// sendiri, lalu hasilnya digabung dengan merge().
+//
+// Rentang bucket dibatasi max_span (bawaan MAX_SPAN_BUCKETS): paket yang akan memperlebar
+// rentang melewati batas itu (timestamp rusak, mis. 0 atau epoch tahun 2100)
+// dibuang dan dihitung sebagai outlier, bukan mengalokasikan ratusan juta
+// bucket kosong. Timestamp NaN/inf atau yang offset intervalnya melewati
+// +-2^62 juga menjadi outlier. Paket tidak terurut di depan bucket pertama memakai ruang
+// cadangan di depan vektor yang digandakan saat habis, sehingga biaya
+// pergeseran teramortisasi O(1) per bucket.
+class TrafficAggregate {
+public:
+    static constexpr double MIN_INTERVAL = 0.001;  // 1 ms
+    static constexpr double MAX_INTERVAL = 3600.0; // 1 jam
+    static constexpr int64_t MAX_SPAN_BUCKETS = int64_t(1) << 23; // ~128 MB counter
+    // Offset interval di luar +-2^62 (atau NaN/inf) tidak diubah ke int64
+    static constexpr double MAX_OFFSET = 4611686018427387904.0; // 2^62
+    static constexpr int64_t INVALID_ID = INT64_MIN;
+
+private:
+    double origin;            // Timestamp awal interval ke-0
+    double interval_duration; // Lebar interval dalam detik
+    double inv_interval;      // 1 / interval_duration (hindari pembagian)
+    int64_t storage_id;       // interval_id untuk elemen vektor indeks 0
+    int64_t first_id;         // interval_id bucket pertama yang terpakai
+    int64_t max_span;         // Jumlah bucket maksimum [first, last]
+    int64_t outliers;         // Paket dibuang karena di luar rentang
+    std::vector<int64_t> bytes;   // [0, first_id - storage_id) = cadangan depan
+    std::vector<int64_t> packets;
+
+    size_t headroom() const { return static_cast<size_t>(first_id - storage_id); }
+    bool growTo(int64_t interval_id);
+
+public:
+    TrafficAggregate(double origin_time = 0.0, double interval_seconds = 300.0,
+                     int64_t max_span_buckets = MAX_SPAN_BUCKETS);
+
+    static bool isValidInterval(double interval_seconds) {
+        return interval_seconds >= MIN_INTERVAL && interval_seconds <= MAX_INTERVAL;
+    }
+
+    // INVALID_ID jika timestamp tidak berhingga atau terlalu jauh dari origin
+    int64_t intervalId(double timestamp) const {
+        double offset = (timestamp - origin) * inv_interval;
+        if (!(std::fabs(offset) <= MAX_OFFSET)) return INVALID_ID;
+        int64_t id = static_cast<int64_t>(offset);
+        if (offset < 0 && static_cast<double>(id) != offset) --id; // floor
+        return id;
+    }
+
+    bool add(double timestamp, int64_t length) {
+        return addToInterval(intervalId(timestamp), length);
+    }
+
+    // Tambah paket ke interval yang id-nya sudah dihitung pemanggil; false
+    // jika paket dibuang sebagai outlier (pemanggil melewati agregat lain
+    // yang diindeks dengan id yang sama)
+    bool addToInterval(int64_t id, int64_t length) {
+        // Selisih unsigned: tetap terdefinisi untuk id jauh di luar rentang
+        size_t index = static_cast<size_t>(static_cast<uint64_t>(id) - static_cast<uint64_t>(storage_id));
+        if (id < first_id || index >= bytes.size()) {
+            if (id == INVALID_ID || !growTo(id)) {
+                outliers++;
+                return false;
+            }
+            index = static_cast<size_t>(id - storage_id);
+        }
+        bytes[index] += length;
+        packets[index] += 1;
+        return true;
+    }
+
+    // Gabungkan agregat lain dengan origin dan interval yang sama
+    void merge(const TrafficAggregate& other);
+
+    double getOrigin() const { return origin; }
+    double getIntervalDuration() const { return interval_duration; }
+    bool empty() const { return bytes.empty(); }
+    int64_t totalPackets() const;
+    int64_t outlierPackets() const { return outliers; }
+    int64_t maxSpan() const { return max_span; }
+
+    // Akses bucket: indeks 0..bucketCount()-1 (termasuk bucket kosong)
+    size_t bucketCount() const { return bytes.size() - headroom(); }
+    int64_t bucketBytes(size_t index) const { return bytes[headroom() + index]; }
+    int64_t bucketPackets(size_t index) const { return packets[headroom() + index]; }
+    int64_t bucketIntervalId(size_t index) const { return first_id + static_cast<int64_t>(index); }
+    double bucketStart(size_t index) const {
+        return origin + static_cast<double>(bucketIntervalId(index)) * interval_duration;
+    }
+};
+
+#endif // TRAFFIC_AGGREGATOR_H
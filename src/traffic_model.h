@@ -0,0 +1,134 @@
+#ifndef TRAFFIC_MODEL_H
+#define TRAFFIC_MODEL_H
+
+#include <cmath>
+
+// Parameter model dinamika traffic:
+//   dB/dt = -decay * (B - baseline) + amplitude * sin(2*pi/period * (t - time_offset) + phase)
+// Default = konstanta asli trafficDynamicsModel (puncak jam 9-10,
+// baseline 0); ModelCalibrator menyesuaikannya ke data.
+struct TrafficModelParams {
+    double decay;
+    double amplitude;
+    double period_hours;  // 24-hour cycle
+    double phase;
+    double time_offset;
+    double baseline;      // Level keseimbangan (Mbps) yang dituju decay
+
+    TrafficModelParams()
+        : decay(0.03), amplitude(1.2), period_hours(24.0), phase(M_PI / 4), time_offset(6.0), baseline(0.0) {}
+
+    double frequency() const { return 2 * M_PI / period_hours; }
+
+    double derivative(double t, double bandwidth) const {
+        return -decay * (bandwidth - baseline) + amplitude * sin(frequency() * (t - time_offset) + phase);
+    }
+};
+
+// Policy model untuk integrator ODE (OdeIntegrator::integrate<Model>):
+// functor double(double t, double B) const tanpa virtual, sehingga
+// ruas kanan diinline ke loop tahap RK.
+
+// Model asli: decay ke baseline + satu harmonik harian
+struct SeasonalDecayModel {
+    TrafficModelParams params;
+
+    double operator()(double t, double bandwidth) const { return params.derivative(t, bandwidth); }
+};
+
+// Decay ke baseline + beberapa harmonik periode/k (mis. 24 jam dan 12 jam
+// untuk pola dua puncak pagi/sore)
+struct MultiHarmonicModel {
+    static const int MAX_HARMONICS = 4;
+
+    TrafficModelParams base;  // decay, baseline, period, time_offset
+    int harmonics;
+    double amplitudes[MAX_HARMONICS];  // amplitudes[k-1] untuk periode period/k
+    double phases[MAX_HARMONICS];
+
+    // Harmonik pertama = model seasonal; harmonik 12 jam sepertiga amplitudonya
+    MultiHarmonicModel() : harmonics(2) {
+        for (int k = 0; k < MAX_HARMONICS; k++) {
+            amplitudes[k] = 0.0;
+            phases[k] = 0.0;
+        }
+        amplitudes[0] = base.amplitude;
+        phases[0] = base.phase;
+        amplitudes[1] = base.amplitude / 3.0;
+    }
+
+    double operator()(double t, double bandwidth) const {
+        double angle = base.frequency() * (t - base.time_offset);
+        double forcing = 0.0;
+        for (int k = 0; k < harmonics; k++) {
+            forcing += amplitudes[k] * sin((k + 1) * angle + phases[k]);
+        }
+        return -base.decay * (bandwidth - base.baseline) + forcing;
+    }
+};
+
+// Saturasi logistik: laju r(t) = growth * sin(w * (t - time_offset) + phase)
+// berayun harian. Saat r > 0 pertumbuhan logistik dibatasi kapasitas link,
+// saat r < 0 traffic meluruh eksponensial:
+//   dB/dt = r * B * (1 - B / capacity)  (r > 0),   r * B  (r <= 0)
+// Peluruhan tidak ikut faktor logistik agar B di atas kapasitas tetap
+// turun (r < 0 dengan 1 - B/capacity < 0 akan tumbuh tanpa batas).
+struct LogisticSaturationModel {
+    double growth;        // Laju relatif maksimum (per jam)
+    double capacity;      // Kapasitas link (Mbps)
+    double period_hours;
+    double phase;
+    double time_offset;
+
+    LogisticSaturationModel()
+        : growth(0.5), capacity(10.0), period_hours(24.0), phase(M_PI / 4), time_offset(6.0) {}
+
+    double operator()(double t, double bandwidth) const {
+        double rate = growth * sin(2 * M_PI / period_hours * (t - time_offset) + phase);
+        return rate > 0.0 ? rate * bandwidth * (1.0 - bandwidth / capacity) : rate * bandwidth;
+    }
+};
+
+enum class TrafficModelKind {
+    SeasonalDecay,
+    MultiHarmonic,
+    LogisticSaturation
+};
+
+// Registry model: satu instance per jenis dan model aktif. dispatch()
+// memilih tipe konkret sekali per integrasi lewat switch; visitor
+// (functor dengan operator() template) lalu menjalankan integrator yang
+// sudah dispesialisasi untuk model itu, tanpa virtual call per langkah.
+struct TrafficModelRegistry {
+    static const int COUNT = 3;
+
+    TrafficModelKind active;
+    SeasonalDecayModel seasonal;
+    MultiHarmonicModel multi_harmonic;
+    LogisticSaturationModel logistic;
+
+    TrafficModelRegistry() : active(TrafficModelKind::SeasonalDecay) {}
+
+    static TrafficModelKind kindAt(int index) { return static_cast<TrafficModelKind>(index); }
+
+    static const char* name(TrafficModelKind kind) {
+        switch (kind) {
+            case TrafficModelKind::SeasonalDecay: return "Seasonal decay (1 harmonik)";
+            case TrafficModelKind::MultiHarmonic: return "Multi-harmonik (24 jam + 12 jam)";
+            case TrafficModelKind::LogisticSaturation: return "Saturasi logistik (kapasitas link)";
+        }
+        return "-";
+    }
+
+    template <typename Visitor>
+    typename Visitor::result_type dispatch(const Visitor& visitor) const {
+        switch (active) {
+            case TrafficModelKind::MultiHarmonic: return visitor(multi_harmonic);
+            case TrafficModelKind::LogisticSaturation: return visitor(logistic);
+            case TrafficModelKind::SeasonalDecay: break;
+        }
+        return visitor(seasonal);
+    }
+};
+
+#endif // TRAFFIC_MODEL_H
@@ -0,0 +1,143 @@
+#include "traffic_profile.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+// Jumlah interval minimum per thread; di bawahnya overhead thread lebih mahal
+static const size_t MIN_POINTS_PER_THREAD = 4096;
+
+TrafficProfile::TrafficProfile(const ProfileOptions& profile_options)
+    : options(profile_options), day_count(0) {}
+
+const char* TrafficProfile::dayName(int day) {
+    static const char* names[DAYS_PER_WEEK] = {"Senin", "Selasa", "Rabu", "Kamis", "Jumat", "Sabtu", "Minggu"};
+    return (day >= 0 && day < DAYS_PER_WEEK) ? names[day] : "-";
+}
+
+void TrafficProfile::build(const std::vector<double>& timestamps, const std::vector<double>& values,
+                           double interval_seconds, unsigned num_threads) {
+    size_t slot_count = options.by_day_of_week ? HOURS_PER_DAY * DAYS_PER_WEEK : HOURS_PER_DAY;
+    size_t n = std::min(timestamps.size(), values.size());
+    slots.assign(slot_count, ProfileSlot());
+    day_count = 0;
+    if (n == 0) return;
+
+    // Hari lokal dan slot setiap interval, dari titik tengah interval
+    double shift = interval_seconds / 2.0 + options.utc_offset_hours * 3600.0;
+    std::vector<int64_t> days(n);
+    std::vector<uint16_t> slot_of(n);
+    for (size_t i = 0; i < n; i++) {
+        double local = timestamps[i] + shift;
+        int64_t day = static_cast<int64_t>(std::floor(local / 86400.0));
+        int hour = static_cast<int>((local - static_cast<double>(day) * 86400.0) / 3600.0);
+        if (hour >= HOURS_PER_DAY) hour = HOURS_PER_DAY - 1; // Pembulatan di batas hari
+        size_t slot = static_cast<size_t>(hour);
+        if (options.by_day_of_week) {
+            int weekday = static_cast<int>(((day + 3) % 7 + 7) % 7); // 1970-01-01 = Kamis
+            slot += static_cast<size_t>(weekday) * HOURS_PER_DAY;
+        }
+        days[i] = day;
+        slot_of[i] = static_cast<uint16_t>(slot);
+    }
+
+    // Urutkan indeks menurut hari (stabil: urutan waktu dalam hari tetap)
+    std::vector<size_t> order(n);
+    for (size_t i = 0; i < n; i++) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&days](size_t a, size_t b) { return days[a] < days[b]; });
+
+    // Batas rentang per hari di dalam 'order'
+    std::vector<size_t> day_bounds;
+    for (size_t i = 0; i < n; i++) {
+        if (i == 0 || days[order[i]] != days[order[i - 1]]) day_bounds.push_back(i);
+    }
+    day_count = day_bounds.size();
+    day_bounds.push_back(n);
+
+    if (num_threads == 0) {
+        num_threads = std::thread::hardware_concurrency();
+        if (num_threads == 0) num_threads = 1;
+        unsigned useful = static_cast<unsigned>(n / MIN_POINTS_PER_THREAD) + 1;
+        if (num_threads > useful) num_threads = useful;
+    }
+    if (num_threads > day_count) num_threads = static_cast<unsigned>(day_count);
+
+    // Setiap thread mengelompokkan rentang hari miliknya ke nilai per slot
+    std::vector<std::vector<std::vector<double>>> partials(num_threads,
+        std::vector<std::vector<double>>(slot_count));
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < num_threads; t++) {
+        size_t first_day = day_count * t / num_threads;
+        size_t last_day = day_count * (t + 1) / num_threads;
+        workers.push_back(std::thread([&, t, first_day, last_day]() {
+            std::vector<std::vector<double>>& partial = partials[t];
+            for (size_t i = day_bounds[first_day]; i < day_bounds[last_day]; i++) {
+                size_t index = order[i];
+                partial[slot_of[index]].push_back(values[index]);
+            }
+        }));
+    }
+    for (auto& worker : workers) worker.join();
+
+    // Gabungkan partial berurutan hari, lalu hitung statistik per slot.
+    // Penjumlahan selalu dengan urutan yang sama -> hasil deterministik.
+    std::vector<double> merged;
+    for (size_t s = 0; s < slot_count; s++) {
+        merged.clear();
+        for (unsigned t = 0; t < num_threads; t++) {
+            merged.insert(merged.end(), partials[t][s].begin(), partials[t][s].end());
+        }
+
+        ProfileSlot& result = slots[s];
+        result.count = merged.size();
+        result.interpolated = false;
+        result.mean = result.median = result.max = 0.0;
+        if (merged.empty()) continue;
+
+        double sum = 0.0;
+        double max_value = merged[0];
+        for (double value : merged) {
+            sum += value;
+            if (value > max_value) max_value = value;
+        }
+        result.mean = sum / merged.size();
+        result.max = max_value;
+
+        size_t middle = merged.size() / 2;
+        std::nth_element(merged.begin(), merged.begin() + middle, merged.end());
+        double upper = merged[middle];
+        if (merged.size() % 2 == 0) {
+            double lower = *std::max_element(merged.begin(), merged.begin() + middle);
+            result.median = (lower + upper) / 2.0;
+        } else {
+            result.median = upper;
+        }
+    }
+
+    fillEmptySlots();
+}
+
+void TrafficProfile::fillEmptySlots() {
+    size_t n = slots.size();
+    size_t filled = 0;
+    for (const ProfileSlot& s : slots) {
+        if (s.count > 0) filled++;
+    }
+    if (filled == 0 || filled == n) return;
+
+    // Slot diperlakukan melingkar: jam 23 bertetangga dengan jam 0
+    for (size_t i = 0; i < n; i++) {
+        if (slots[i].count > 0) continue;
+        size_t before = 1, after = 1;
+        while (slots[(i + n - before) % n].count == 0) before++;
+        while (slots[(i + after) % n].count == 0) after++;
+        const ProfileSlot& left = slots[(i + n - before) % n];
+        const ProfileSlot& right = slots[(i + after) % n];
+        double weight = static_cast<double>(before) / static_cast<double>(before + after);
+
+        ProfileSlot& target = slots[i];
+        target.mean = left.mean + (right.mean - left.mean) * weight;
+        target.median = left.median + (right.median - left.median) * weight;
+        target.max = left.max + (right.max - left.max) * weight;
+        target.interpolated = true;
+    }
+}
@@ -0,0 +1,65 @@
+#ifndef TRAFFIC_PROFILE_H
+#define TRAFFIC_PROFILE_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Opsi pengelompokan profil
+struct ProfileOptions {
+    bool by_day_of_week;     // 7 x 24 slot (Senin..Minggu) alih-alih 24 slot
+    double utc_offset_hours; // Zona waktu lokal, mis. -5 untuk EST
+
+    ProfileOptions() : by_day_of_week(false), utc_offset_hours(0.0) {}
+};
+
+// Statistik satu slot profil (mis. jam 08:00-09:00)
+struct ProfileSlot {
+    size_t count;      // Jumlah interval yang jatuh ke slot ini
+    double mean;       // Rata-rata bandwidth (Mbps)
+    double median;
+    double max;
+    bool interpolated; // true jika slot kosong dan diisi dari slot tetangga
+};
+
+// Profil jam-harian dari data nyata: setiap interval teragregasi
+// dikelompokkan menurut jam lokal (dan opsional hari dalam minggu) dari
+// titik tengahnya, lalu dihitung mean/median/max per slot. Pengelompokan
+// dikerjakan paralel per rentang hari; partial digabung berurutan hari
+// sehingga hasilnya identik berapa pun jumlah thread-nya. Slot tanpa
+// data diisi interpolasi linear melingkar dari slot terisi terdekat.
+class TrafficProfile {
+public:
+    static const int HOURS_PER_DAY = 24;
+    static const int DAYS_PER_WEEK = 7;
+
+private:
+    ProfileOptions options;
+    std::vector<ProfileSlot> slots;
+    size_t day_count;
+
+    void fillEmptySlots();
+
+public:
+    explicit TrafficProfile(const ProfileOptions& profile_options = ProfileOptions());
+
+    // timestamps = awal interval (detik Unix), values = bandwidth (Mbps).
+    // num_threads = 0 memilih otomatis (1 thread untuk data kecil).
+    void build(const std::vector<double>& timestamps, const std::vector<double>& values,
+               double interval_seconds, unsigned num_threads = 0);
+
+    bool empty() const { return day_count == 0; }
+    size_t slotCount() const { return slots.size(); }
+    size_t dayCount() const { return day_count; }
+    const ProfileSlot& slot(size_t index) const { return slots[index]; }
+    int slotHour(size_t index) const { return static_cast<int>(index % HOURS_PER_DAY); }
+    // Hari dalam minggu (0 = Senin), -1 jika profil hanya per jam
+    int slotDay(size_t index) const {
+        return options.by_day_of_week ? static_cast<int>(index / HOURS_PER_DAY) : -1;
+    }
+    const ProfileOptions& getOptions() const { return options; }
+
+    static const char* dayName(int day);
+};
+
+#endif // TRAFFIC_PROFILE_H
@@ -0,0 +1,114 @@
+// Levenberg-Marquardt harus memulihkan parameter yang dipakai membangkitkan
+// data sintetis (tanpa noise: persis, dengan noise kecil: mendekati),
+// melaporkan converged, dan menolak step_hours tidak positif.
+#include "check.h"
+#include "model_calibrator.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+
+// Selisih fase modulo 2*pi
+double phaseDistance(double a, double b) {
+    double difference = std::fmod(std::fabs(a - b), 2.0 * PI);
+    return std::min(difference, 2.0 * PI - difference);
+}
+
+void checkRecovery(const char* name, const CalibrationResult& result, const TrafficModelParams& truth,
+                   double initial_value, double tolerance) {
+    CHECK(result.converged, "%s: tidak konvergen (%zu iterasi)", name, result.iterations);
+    CHECK(std::fabs(result.params.decay - truth.decay) < tolerance, "%s: decay %.6f", name, result.params.decay);
+    CHECK(std::fabs(result.params.amplitude - truth.amplitude) < tolerance, "%s: amplitude %.6f", name, result.params.amplitude);
+    CHECK(phaseDistance(result.params.phase, truth.phase) < tolerance, "%s: phase %.6f", name, result.params.phase);
+    CHECK(std::fabs(result.params.baseline - truth.baseline) < tolerance, "%s: baseline %.6f", name, result.params.baseline);
+    CHECK(std::fabs(result.initial_value - initial_value) < tolerance, "%s: B(t0) %.6f", name, result.initial_value);
+    CHECK(result.rmse <= result.initial_rmse, "%s: RMSE naik %.6f -> %.6f", name, result.initial_rmse, result.rmse);
+}
+
+} // namespace
+
+int main() {
+    TrafficModelParams truth;
+    truth.decay = 0.15;
+    truth.amplitude = 2.5;
+    truth.phase = -0.7;
+    truth.baseline = 6.0;
+    const double initial_value = 4.0;
+
+    std::vector<double> times;
+    for (int i = 0; i <= 96; i++) times.push_back(0.5 * i);
+    size_t n = times.size();
+    std::vector<double> clean(n);
+    CalibrationOptions options;
+    options.threads = 1;
+    CHECK(ModelCalibrator::simulate(truth, initial_value, times.data(), n, options, clean.data()), "simulate gagal");
+
+    // Tebakan awal default dan dari regresi harmonik harus sama-sama pulih
+    TrafficModelParams guess;
+    for (int harmonic = 0; harmonic < 2; harmonic++) {
+        options.harmonic_guess = harmonic != 0;
+        const char* name = harmonic ? "tanpa noise, tebakan harmonik" : "tanpa noise, tebakan default";
+        CalibrationResult result = ModelCalibrator::fit(times.data(), clean.data(), n, guess, options);
+        CHECK(result.points == n, "%s: %zu titik", name, result.points);
+        checkRecovery(name, result, truth, initial_value, 1e-4);
+        CHECK(result.rmse < 1e-6, "%s: RMSE %.3e", name, result.rmse);
+    }
+
+    // Noise deterministik kecil: parameter mendekati, RMSE ~ amplitudo noise
+    std::vector<double> noisy(clean);
+    for (size_t i = 0; i < n; i++) noisy[i] += 0.05 * std::sin(37.0 * static_cast<double>(i));
+    options.harmonic_guess = true;
+    CalibrationResult noisy_result = ModelCalibrator::fit(times.data(), noisy.data(), n, guess, options);
+    checkRecovery("noise 0.05", noisy_result, truth, initial_value, 0.1);
+    CHECK(noisy_result.rmse < 0.05, "noise 0.05: RMSE %.4f", noisy_result.rmse);
+
+    // Residual hampir nol (noise ~1e-7 Mbps): harus berhenti lewat batas
+    // absolut RMSE <= tolerance x RMS data dan dilaporkan konvergen. Dengan
+    // uji relatif saja, tebakan default di sini macet (lambda maksimum) dan
+    // dilaporkan belum konvergen walaupun RMSE sudah ~1e-7.
+    std::vector<double> tiny(clean);
+    for (size_t i = 0; i < n; i++) {
+        double x = static_cast<double>(i);
+        tiny[i] += 1e-7 * (std::sin(37.0 * x) + std::cos(11.0 * x * x));
+    }
+    for (int harmonic = 0; harmonic < 2; harmonic++) {
+        options.harmonic_guess = harmonic != 0;
+        CalibrationResult tiny_result = ModelCalibrator::fit(times.data(), tiny.data(), n, guess, options);
+        checkRecovery("noise 1e-7", tiny_result, truth, initial_value, 1e-4);
+        CHECK(tiny_result.iterations < options.max_iterations, "noise 1e-7: %zu iterasi", tiny_result.iterations);
+        CHECK(tiny_result.rmse < 1e-6, "noise 1e-7: RMSE %.3e", tiny_result.rmse);
+    }
+
+    // Batch paralel = fit satu per satu
+    std::vector<CalibrationSeries> batch(3);
+    for (size_t s = 0; s < batch.size(); s++) {
+        TrafficModelParams params = truth;
+        params.baseline = 3.0 + 2.0 * s;
+        batch[s].times = times;
+        batch[s].values.resize(n);
+        ModelCalibrator::simulate(params, initial_value, times.data(), n, options, batch[s].values.data());
+    }
+    options.threads = 0;
+    std::vector<CalibrationResult> batch_results = ModelCalibrator::fitBatch(batch, guess, options);
+    CHECK(batch_results.size() == batch.size(), "batch: %zu hasil", batch_results.size());
+    for (size_t s = 0; s < batch_results.size(); s++) {
+        TrafficModelParams params = truth;
+        params.baseline = 3.0 + 2.0 * s;
+        checkRecovery("batch", batch_results[s], params, initial_value, 1e-4);
+    }
+
+    // step_hours tidak positif: simulate false tanpa menulis, fit kosong
+    for (int invalid = 0; invalid < 2; invalid++) {
+        options.step_hours = invalid ? -0.1 : 0.0;
+        std::vector<double> untouched(n, -1.0);
+        CHECK(!ModelCalibrator::simulate(truth, initial_value, times.data(), n, options, untouched.data()),
+              "step %.1f: simulate diterima", options.step_hours);
+        CHECK(untouched[0] == -1.0 && untouched[n - 1] == -1.0, "step %.1f: hasil ditulis", options.step_hours);
+        CalibrationResult result = ModelCalibrator::fit(times.data(), clean.data(), n, guess, options);
+        CHECK(result.points == 0 && !result.converged, "step %.1f: fit tidak ditolak", options.step_hours);
+    }
+    return checkResult("calibration_check");
+}
@@ -0,0 +1,29 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <cstdio>
+#include <cmath>
+
+// Pemeriksaan minimal untuk program uji di tests/: setiap CHECK yang gagal
+// dicetak dengan lokasi, dan checkResult() menjadi kode keluar program
+// (0 = semua lolos) sehingga `make -f Makefile.universal check` berhenti
+// pada uji pertama yang gagal.
+static int check_failures = 0;
+
+#define CHECK(condition, ...)                                                  \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            check_failures++;                                                  \
+            std::printf("GAGAL %s:%d: %s -- ", __FILE__, __LINE__, #condition); \
+            std::printf(__VA_ARGS__);                                          \
+            std::printf("\n");                                                 \
+        }                                                                      \
+    } while (0)
+
+inline int checkResult(const char* name) {
+    if (check_failures == 0) std::printf("OK   %s\n", name);
+    else std::printf("GAGAL %s: %d pemeriksaan\n", name, check_failures);
+    return check_failures == 0 ? 0 : 1;
+}
+
+#endif // CHECK_H
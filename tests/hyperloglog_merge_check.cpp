@@ -0,0 +1,53 @@
+// Gabungan HyperLogLog: union dua sketch (sparse, dense, campuran) harus
+// sama persis dengan satu sketch yang melihat semua host, dan estimasinya
+// berada dalam 4 galat standar dari kardinalitas sebenarnya.
+#include "check.h"
+#include "hyperloglog.h"
+
+namespace {
+
+// Host first..first+count-1 sebagai alamat IPv4 berurutan
+void addHosts(HyperLogLog& sketch, uint32_t first, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) sketch.add(IpAddress::fromV4(0x0a000000u + first + i));
+}
+
+} // namespace
+
+int main() {
+    // (jumlah host a, jumlah host b, tumpang tindih): sparse+sparse,
+    // sparse+dense, dense+dense
+    const uint32_t cases[][3] = {{150, 120, 50}, {200, 40000, 100}, {150000, 120000, 70000}};
+    const int precisions[] = {10, 12, 14};
+    for (int precision : precisions) {
+        for (const uint32_t* c : cases) {
+            HyperLogLog a(precision), b(precision), all(precision);
+            uint32_t b_first = c[0] - c[2];
+            addHosts(a, 0, c[0]);
+            addHosts(b, b_first, c[1]);
+            addHosts(all, 0, b_first + c[1]);
+
+            HyperLogLog merged = a;
+            merged.merge(b);
+            HyperLogLog reversed = b;
+            reversed.merge(a);
+
+            double truth = static_cast<double>(b_first + c[1]);
+            double estimate = merged.estimate();
+            CHECK(estimate == all.estimate(), "p=%d n=%.0f: gabungan %.6g != langsung %.6g", precision, truth,
+                  estimate, all.estimate());
+            CHECK(reversed.estimate() == estimate, "p=%d n=%.0f: merge tidak komutatif", precision, truth);
+            double error = std::fabs(estimate - truth) / truth;
+            CHECK(error < 4.0 * merged.standardError(), "p=%d n=%.0f: galat relatif %.4f > 4 x %.4f", precision,
+                  truth, error, merged.standardError());
+        }
+    }
+
+    // Presisi berbeda tidak boleh digabung
+    HyperLogLog coarse(10), fine(12);
+    addHosts(coarse, 0, 1000);
+    addHosts(fine, 5000, 1000);
+    double before = coarse.estimate();
+    coarse.merge(fine);
+    CHECK(coarse.estimate() == before, "presisi berbeda ikut tergabung");
+    return checkResult("hyperloglog_merge_check");
+}
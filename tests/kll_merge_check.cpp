@@ -0,0 +1,57 @@
+// Gabungan sketch KLL: empat sketch parsial yang digabung harus menjaga
+// count/min/max persis dan galat rank kuantil dalam batas ~1.65/k.
+#include "check.h"
+#include "kll_sketch.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Rank sebenarnya (fraksi nilai <= x) pada data terurut
+double trueRank(const std::vector<double>& sorted, double x) {
+    return static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), x) - sorted.begin()) /
+           static_cast<double>(sorted.size());
+}
+
+} // namespace
+
+int main() {
+    const size_t N = 400000, PARTS = 4;
+    const double quantiles[] = {0.05, 0.5, 0.95, 0.99};
+    const size_t ks[] = {100, 200, 400};
+
+    std::mt19937_64 rng(2024);
+    std::lognormal_distribution<double> distribution(0.0, 1.0);
+    std::vector<double> values(N);
+    for (double& value : values) value = distribution(rng);
+    std::vector<double> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (size_t k : ks) {
+        std::vector<KllSketch> parts(PARTS, KllSketch(k));
+        KllSketch single(k);
+        for (size_t i = 0; i < N; i++) {
+            parts[i % PARTS].add(values[i]);
+            single.add(values[i]);
+        }
+        KllSketch merged(k);
+        for (const KllSketch& part : parts) merged.merge(part);
+
+        CHECK(merged.count() == N, "k=%zu: count %llu", k, static_cast<unsigned long long>(merged.count()));
+        CHECK(merged.min() == sorted.front() && merged.max() == sorted.back(), "k=%zu: min/max", k);
+        CHECK(merged.retained() < 4 * k, "k=%zu: menyimpan %zu nilai", k, merged.retained());
+
+        // Batas ~1.65/k dengan kelonggaran 1.5x untuk variasi acak kompaksi
+        double bound = 1.5 * 1.65 / static_cast<double>(k);
+        for (double q : quantiles) {
+            double merged_error = std::fabs(trueRank(sorted, merged.quantile(q)) - q);
+            double single_error = std::fabs(trueRank(sorted, single.quantile(q)) - q);
+            CHECK(merged_error < bound, "k=%zu q=%.2f: galat rank gabungan %.5f > %.5f", k, q, merged_error, bound);
+            CHECK(single_error < bound, "k=%zu q=%.2f: galat rank tunggal %.5f > %.5f", k, q, single_error, bound);
+            double rank_error = std::fabs(merged.rank(sorted[static_cast<size_t>(q * (N - 1))]) - q);
+            CHECK(rank_error < bound, "k=%zu q=%.2f: galat rank() %.5f", k, q, rank_error);
+        }
+    }
+    return checkResult("kll_merge_check");
+}
@@ -0,0 +1,86 @@
+// Event batas bawah Dormand-Prince/RK4: mendarat tepat di floor, menempel,
+// lalu lepas di titik tekuk tanpa menggantung untuk step <= 0 / min_step <= 0.
+// RK4 langkah tetap mempertahankan semantik lama (potong setelah langkah).
+#include "check.h"
+#include "ode_forecaster.h"
+
+namespace {
+
+// Turun sebelum t = 50, naik sesudahnya: solusi dari floor menempel
+// sampai t = 50 lalu naik linear
+struct ReleaseAt50 {
+    double operator()(double t, double) const { return t < 50.0 ? -1.0 : 1.0; }
+};
+
+// Turun konstan dari y0 = 5: menyentuh floor 0 tepat di t = 5
+struct ConstantDrain {
+    double operator()(double, double) const { return -1.0; }
+};
+
+// Turun ke floor lalu naik setelah t = 4 (di tengah langkah 0.3 jam)
+struct DrainThenFill {
+    double operator()(double t, double y) const { return (t < 4.0 ? -3.0 : 0.5) - 0.2 * y; }
+};
+
+// Loop RK4 lama rk4BandwidthPrediction: tahap memakai f apa adanya, y
+// dipotong ke floor hanya setelah setiap langkah
+double legacyRk4(double t, double y, double h, double t_end, double floor_value) {
+    DrainThenFill f;
+    while (t < t_end - 1e-9) {
+        double k1 = h * f(t, y);
+        double k2 = h * f(t + h / 2, y + k1 / 2);
+        double k3 = h * f(t + h / 2, y + k2 / 2);
+        double k4 = h * f(t + h, y + k3);
+        y += (k1 + 2 * k2 + 2 * k3 + k4) / 6.0;
+        t += h;
+        if (y < floor_value) y = floor_value;
+    }
+    return y;
+}
+
+} // namespace
+
+int main() {
+    const double steps[] = {0.0, 0.1};
+    const double min_steps[] = {1e-9, 0.0, -1.0};
+    for (double step : steps) {
+        for (double min_step : min_steps) {
+            OdeOptions options;
+            options.step = step;
+            options.min_step = min_step;
+            options.floor_value = 0.0;
+            OdeStats stats;
+            DenseTrajectory trajectory = OdeIntegrator::integrate(ReleaseAt50(), 0.0, 0.0, 100.0, options, &stats);
+            CHECK(stats.completed, "step=%g min_step=%g", step, min_step);
+            CHECK(std::fabs(trajectory.endValue() - 50.0) < 1e-6, "step=%g min_step=%g akhir=%.9g", step, min_step,
+                  trajectory.endValue());
+            CHECK(std::fabs(trajectory.evaluate(30.0)) < 1e-12, "menempel: y(30)=%.3g", trajectory.evaluate(30.0));
+            CHECK(std::fabs(trajectory.evaluate(55.0) - 5.0) < 1e-6, "lepas: y(55)=%.9g", trajectory.evaluate(55.0));
+        }
+    }
+
+    OdeMethod methods[] = {OdeMethod::DormandPrince, OdeMethod::ClassicRk4};
+    for (OdeMethod method : methods) {
+        OdeOptions options;
+        options.method = method;
+        options.floor_value = 0.0;
+        DenseTrajectory trajectory = OdeIntegrator::integrate(ConstantDrain(), 0.0, 5.0, 20.0, options);
+        const char* name = OdeIntegrator::methodName(method);
+        CHECK(std::fabs(trajectory.evaluate(2.5) - 2.5) < 1e-6, "%s: y(2.5)=%.9g", name, trajectory.evaluate(2.5));
+        CHECK(trajectory.endValue() == 0.0, "%s: akhir=%.3g", name, trajectory.endValue());
+        double lowest = 0.0;
+        for (int i = 0; i <= 2000; i++) lowest = std::min(lowest, trajectory.evaluate(0.01 * i));
+        CHECK(lowest >= 0.0, "%s: dense output di bawah floor (%.3g)", name, lowest);
+    }
+    OdeOptions legacy;
+    legacy.method = OdeMethod::ClassicRk4;
+    legacy.step = 0.3;
+    legacy.floor_value = 1.0;
+    for (int end = 1; end <= 40; end++) {
+        double t_end = 0.3 * end;
+        double expected = legacyRk4(0.0, 5.0, 0.3, t_end, 1.0);
+        double actual = OdeIntegrator::integrate(DrainThenFill(), 0.0, 5.0, t_end, legacy).endValue();
+        CHECK(std::fabs(actual - expected) < 1e-12, "RK4 lama t=%.1f: %.15g vs %.15g", t_end, actual, expected);
+    }
+    return checkResult("ode_floor_check");
+}
@@ -0,0 +1,103 @@
+// PeakFinder dibandingkan dengan referensi brute force O(n^2): maksimum
+// lokal (tengah plateau), base kiri/kanan = minimum terdekat sebelum titik
+// lebih tinggi, prominence, serta filter tinggi/prominence.
+#include "check.h"
+#include "peak_finder.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<Peak> bruteForce(const std::vector<double>& y, double min_prominence, double min_height) {
+    std::vector<Peak> peaks;
+    size_t n = y.size();
+    for (size_t i = 1; i + 1 < n; i++) {
+        if (!(y[i - 1] < y[i])) continue;
+        size_t end = i;
+        while (end + 1 < n && y[end + 1] == y[i]) end++;
+        if (end + 1 >= n || !(y[end + 1] < y[i])) continue;
+
+        Peak peak;
+        peak.index = (i + end) / 2;
+        peak.height = y[i];
+        // Minimum pertama yang ditemui dari peak ke arah luar (terdekat)
+        double left_min = peak.height, right_min = peak.height;
+        peak.left_base = peak.right_base = peak.index;
+        for (size_t k = peak.index + 1; k-- > 0 && y[k] <= peak.height;) {
+            if (y[k] < left_min) {
+                left_min = y[k];
+                peak.left_base = k;
+            }
+        }
+        for (size_t k = peak.index; k < n && y[k] <= peak.height; k++) {
+            if (y[k] < right_min) {
+                right_min = y[k];
+                peak.right_base = k;
+            }
+        }
+        peak.prominence = peak.height - std::max(left_min, right_min);
+        if (peak.height < min_height || peak.prominence < min_prominence) continue;
+        peaks.push_back(peak);
+    }
+    return peaks;
+}
+
+void compare(const char* name, const std::vector<double>& y, double min_prominence, double min_height) {
+    PeakOptions options;
+    options.min_prominence = min_prominence;
+    options.min_height = min_height;
+    std::vector<Peak> found = PeakFinder::find(y.data(), y.size(), options);
+    std::vector<Peak> expected = bruteForce(y, min_prominence, min_height);
+    CHECK(found.size() == expected.size(), "%s: %zu peak, referensi %zu", name, found.size(), expected.size());
+    if (found.size() != expected.size()) return;
+    for (size_t i = 0; i < found.size(); i++) {
+        const Peak& a = found[i];
+        const Peak& b = expected[i];
+        CHECK(a.index == b.index && a.left_base == b.left_base && a.right_base == b.right_base,
+              "%s: peak %zu di %zu (base %zu..%zu), referensi %zu (base %zu..%zu)",
+              name, i, a.index, a.left_base, a.right_base, b.index, b.left_base, b.right_base);
+        CHECK(a.prominence == b.prominence, "%s: prominence peak %zu %.6f vs %.6f", name, a.index, a.prominence, b.prominence);
+        CHECK(a.left_edge <= a.index && a.index <= a.right_edge &&
+              a.left_edge >= a.left_base && a.right_edge <= a.right_base,
+              "%s: lebar peak %zu [%.3f, %.3f] di luar base", name, a.index, a.left_edge, a.right_edge);
+    }
+}
+
+} // namespace
+
+int main() {
+    std::mt19937_64 rng(7);
+    const size_t lengths[] = {0, 1, 2, 3, 5, 17, 256, 3000};
+    char name[64];
+
+    for (int seed = 0; seed < 20; seed++) {
+        for (size_t n : lengths) {
+            std::vector<double> noise(n), plateaus(n), wave(n);
+            std::normal_distribution<double> gauss(0.0, 1.0);
+            std::uniform_int_distribution<int> level(0, 4);
+            for (size_t i = 0; i < n; i++) {
+                noise[i] = gauss(rng);
+                // Sedikit tingkat -> banyak plateau dan base yang sama tinggi
+                plateaus[i] = static_cast<double>(level(rng));
+                wave[i] = 10.0 * std::sin(0.05 * static_cast<double>(i)) + 0.3 * gauss(rng);
+            }
+            snprintf(name, sizeof(name), "acak n=%zu seed=%d", n, seed);
+            compare(name, noise, 0.0, -1e300);
+            compare(name, noise, 1.0, -0.5);
+            snprintf(name, sizeof(name), "plateau n=%zu seed=%d", n, seed);
+            compare(name, plateaus, 0.0, -1e300);
+            compare(name, plateaus, 2.0, -1e300);
+            snprintf(name, sizeof(name), "gelombang n=%zu seed=%d", n, seed);
+            compare(name, wave, 0.0, -1e300);
+            compare(name, wave, 5.0, 0.0);
+        }
+    }
+
+    // Plateau di ujung deret bukan peak; plateau di tengah memakai titik tengahnya
+    const double edge[] = {1, 3, 3, 3, 2, 5, 5};
+    std::vector<Peak> peaks = PeakFinder::find(edge, 7);
+    CHECK(peaks.size() == 1 && peaks[0].index == 2, "plateau: %zu peak", peaks.size());
+    return checkResult("peak_finder_check");
+}
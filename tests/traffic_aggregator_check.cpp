@@ -0,0 +1,135 @@
+// TrafficAggregate dengan id acak (maju dan mundur) harus sama dengan
+// referensi std::map setelah merge; id di luar max_span dan timestamp
+// rusak (NaN, 1e30) dihitung sebagai outlier, bukan memperbesar vektor.
+// IngestPipeline tidak meneruskan paket outlier ke tracker per interval.
+#include "check.h"
+#include "traffic_aggregator.h"
+#include "ingest_pipeline.h"
+#include <cstring>
+#include <limits>
+#include <map>
+#include <random>
+#include <utility>
+
+namespace {
+
+typedef std::map<int64_t, std::pair<int64_t, int64_t> > Reference; // id -> (bytes, packets)
+
+void compare(const char* name, const TrafficAggregate& aggregate, const Reference& reference) {
+    CHECK(!reference.empty() && aggregate.bucketIntervalId(0) == reference.begin()->first,
+          "%s: bucket pertama salah", name);
+    CHECK(aggregate.bucketCount() == static_cast<size_t>(reference.rbegin()->first - reference.begin()->first + 1),
+          "%s: %zu bucket", name, aggregate.bucketCount());
+    int64_t total = 0;
+    for (size_t i = 0; i < aggregate.bucketCount(); i++) {
+        Reference::const_iterator it = reference.find(aggregate.bucketIntervalId(i));
+        int64_t bytes = it == reference.end() ? 0 : it->second.first;
+        int64_t packets = it == reference.end() ? 0 : it->second.second;
+        CHECK(aggregate.bucketBytes(i) == bytes && aggregate.bucketPackets(i) == packets,
+              "%s: bucket %lld berbeda", name, static_cast<long long>(aggregate.bucketIntervalId(i)));
+        total += packets;
+    }
+    CHECK(aggregate.totalPackets() == total, "%s: total %lld vs %lld", name,
+          static_cast<long long>(aggregate.totalPackets()), static_cast<long long>(total));
+}
+
+} // namespace
+
+int main() {
+    std::mt19937 rng(1);
+
+    // Dua agregat diisi bergantian dengan timestamp acak di sekitar origin
+    TrafficAggregate first(1000.0, 1.0), second(1000.0, 1.0);
+    Reference reference;
+    for (int i = 0; i < 200000; i++) {
+        double timestamp = 1000.0 + 50000.0 - static_cast<double>(rng() % 100000);
+        TrafficAggregate& target = (i & 1) ? first : second;
+        int64_t length = 10 + i % 7;
+        target.add(timestamp, length);
+        std::pair<int64_t, int64_t>& slot = reference[target.intervalId(timestamp)];
+        slot.first += length;
+        slot.second++;
+    }
+    // Timestamp rusak: jauh sebelum/sesudah (melampaui MAX_SPAN_BUCKETS),
+    // offset di luar int64 dan tidak berhingga
+    const double corrupt[] = {-1e9, 4.1e9, 1e12, 1e30, -1e30, std::numeric_limits<double>::infinity(),
+                              std::numeric_limits<double>::quiet_NaN()};
+    const int corrupt_count = static_cast<int>(sizeof(corrupt) / sizeof(corrupt[0]));
+    for (int i = 0; i < corrupt_count; i++) {
+        CHECK(!first.add(corrupt[i], 5), "timestamp %g diterima", corrupt[i]);
+    }
+    CHECK(first.intervalId(1e30) == TrafficAggregate::INVALID_ID, "1e30 menghasilkan id valid");
+    CHECK(first.outlierPackets() == corrupt_count, "outlier: %lld", static_cast<long long>(first.outlierPackets()));
+    first.merge(second);
+    CHECK(first.outlierPackets() == corrupt_count, "outlier setelah merge: %lld",
+          static_cast<long long>(first.outlierPackets()));
+    compare("acak + merge", first, reference);
+
+    // Rentang kecil: id di luar [first, first + max_span) ditolak di kedua sisi
+    TrafficAggregate bounded(0.0, 1.0, 100);
+    Reference bounded_reference;
+    for (int64_t id = 50; id >= 0; id--) {
+        bounded.addToInterval(id, 1);
+        bounded_reference[id].first++;
+        bounded_reference[id].second++;
+    }
+    bounded.addToInterval(99, 1);
+    bounded_reference[99].first++;
+    bounded_reference[99].second++;
+    bounded.addToInterval(100, 1);
+    bounded.addToInterval(-1, 1);
+    CHECK(bounded.outlierPackets() == 2, "rentang 100: %lld outlier", static_cast<long long>(bounded.outlierPackets()));
+    compare("rentang 100", bounded, bounded_reference);
+
+    // Merge yang melampaui rentang penerima: paket lawan dihitung outlier
+    TrafficAggregate far(0.0, 1.0, 100);
+    far.addToInterval(500, 3);
+    far.addToInterval(501, 4);
+    bounded.merge(far);
+    CHECK(bounded.outlierPackets() == 4, "merge rentang: %lld outlier", static_cast<long long>(bounded.outlierPackets()));
+    compare("merge rentang", bounded, bounded_reference);
+    // CSV dua baris dengan timestamp 1e12: semua tracker aktif, paket kedua
+    // hanya menjadi outlier (sebelumnya tracker HLL/heavy hitter
+    // mengalokasikan ~1e12 slot dan gagal dengan bad_alloc)
+    const char* csv = "1.0,10.0.0.1,10.0.0.2,TCP,100\n"
+                      "1000000000000.0,10.0.0.1,10.0.0.3,TCP,100\n"
+                      "1e30,10.0.0.4,10.0.0.3,UDP,60\n";
+    IngestOptions options;
+    options.interval_seconds = 300.0;
+    options.build_rollup = true;
+    options.aggregate_flows = true;
+    options.heavy_hitter_capacity = 100;
+    options.distinct_precision = 12;
+    IngestPipeline pipeline(options);
+    const char* p = csv;
+    const char* end = csv + std::strlen(csv);
+    PacketRecord record;
+    while (p < end) {
+        if (pipeline.parse(p, end, record)) pipeline.add(record);
+    }
+    CHECK(pipeline.getLinkAggregate().totalPackets() == 1 && pipeline.getLinkAggregate().outlierPackets() == 2,
+          "pipeline: %lld paket, %lld outlier", static_cast<long long>(pipeline.getLinkAggregate().totalPackets()),
+          static_cast<long long>(pipeline.getLinkAggregate().outlierPackets()));
+    CHECK(pipeline.getHeavyHitters().intervalCount() == 1 && pipeline.getDistinctHosts().intervalCount() == 1,
+          "pipeline: tracker %zu/%zu interval", pipeline.getHeavyHitters().intervalCount(),
+          pipeline.getDistinctHosts().intervalCount());
+    CHECK(pipeline.getFlows().size() == 1, "pipeline: %zu flow", pipeline.getFlows().size());
+
+    // Partial paralel yang berjauhan: merge tracker tetap dibatasi rentang
+    IngestPipeline near_part(options), far_part(options);
+    near_part.setOrigin(0.0);
+    far_part.setOrigin(0.0);
+    const char* near_line = "1.0,10.0.0.1,10.0.0.2,TCP,100\n";
+    const char* far_line = "1000000000000.0,10.0.0.1,10.0.0.3,TCP,100\n";
+    p = near_line;
+    if (near_part.parse(p, near_line + std::strlen(near_line), record)) near_part.add(record);
+    p = far_line;
+    if (far_part.parse(p, far_line + std::strlen(far_line), record)) far_part.add(record);
+    near_part.merge(far_part);
+    CHECK(near_part.getHeavyHitters().intervalCount() == 1 && near_part.getDistinctHosts().intervalCount() == 1,
+          "merge pipeline: tracker %zu/%zu interval", near_part.getHeavyHitters().intervalCount(),
+          near_part.getDistinctHosts().intervalCount());
+    CHECK(near_part.getLinkAggregate().outlierPackets() == 1, "merge pipeline: %lld outlier",
+          static_cast<long long>(near_part.getLinkAggregate().outlierPackets()));
+    return checkResult("traffic_aggregator_check");
+}